@@ -33,9 +33,12 @@ SOFTWARE.
 #include <cstring>  // stricmp / strcasecmp
 #include <cstdarg>  // variadic
 #include <sstream>
+#include <bitset>
 #include <iomanip>
 #include <ctime>
 #include <memory>
+#include <new>      // placement new
+#include <cstddef>  // max_align_t
 #include <sys/stat.h>
 #include <cstdio>
 #include <cerrno>
@@ -80,7 +83,27 @@ SOFTWARE.
 // this option need c++17
 #ifndef USE_STD_FILESYSTEM
 #include <dirent.h>
+#if defined(USE_GETDENTS_FILESYSTEM) && defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif  // USE_GETDENTS_FILESYSTEM
+#if defined(USE_IO_URING_STATX) && defined(__linux__)
+#define _IGFD_IO_URING_STATX_
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#endif  // USE_IO_URING_STATX
 #endif  // USE_STD_FILESYSTEM
+#ifdef __linux__
+#define _IGFD_INOTIFY_  // for the directory watching (ImGuiFileDialogFlags_WatchDirectory)
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif  // __linux__
 #define PATH_SEP '/'
 #endif  // _IGFD_UNIX_
 
@@ -96,6 +119,21 @@ SOFTWARE.
 #include <algorithm>
 #include <iostream>
 
+// the search of the names (FileManager::M_SearchInNamesBlob) use sse2, and avx2 if the cpu have it
+#if !defined(DISABLE_SIMD_SEARCH) && (defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__))
+#define _IGFD_SIMD_SEARCH_
+#include <emmintrin.h>
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif  // _MSC_VER
+#if defined(__GNUC__) || defined(__clang__)
+#define IGFD_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define IGFD_TARGET_AVX2
+#endif
+#endif  // _IGFD_SIMD_SEARCH_
+
 ///////////////////////////////
 // STB IMAGE LIBS
 ///////////////////////////////
@@ -137,6 +175,9 @@ SOFTWARE.
 #ifndef FILTER_COMBO_MIN_WIDTH
 #define FILTER_COMBO_MIN_WIDTH 150.0f
 #endif  // FILTER_COMBO_MIN_WIDTH
+#ifndef FILTER_COMBO_SHOW_FILES_COUNT
+#define FILTER_COMBO_SHOW_FILES_COUNT 1
+#endif  // FILTER_COMBO_SHOW_FILES_COUNT
 #ifndef IMGUI_BEGIN_COMBO
 #define IMGUI_BEGIN_COMBO ImGui::BeginCombo
 #endif  // IMGUI_BEGIN_COMBO
@@ -264,6 +305,12 @@ SOFTWARE.
 #ifndef OverWriteDialogCancelButtonString
 #define OverWriteDialogCancelButtonString "Cancel"
 #endif  // OverWriteDialogCancelButtonString
+#ifndef scanningDirectoryString
+#define scanningDirectoryString "Scanning %zu entries..."
+#endif  // scanningDirectoryString
+#ifndef searchingString
+#define searchingString "Searching..."
+#endif  // searchingString
 #ifndef DateTimeFormat
 // see strftime functionin <ctime> for customize
 #define DateTimeFormat "%Y/%m/%d %H:%M"
@@ -277,6 +324,135 @@ SOFTWARE.
 #define SelectAllFilesKey ImGuiKey_A
 #endif  // SelectAllFilesKey
 
+///////////////////////////////
+// FILE SYSTEM
+///////////////////////////////
+
+// size of the buffer used by the getdents64 file system (USE_GETDENTS_FILESYSTEM)
+#ifndef GETDENTS_BUFFER_SIZE
+#define GETDENTS_BUFFER_SIZE (1024U * 1024U)
+#endif  // GETDENTS_BUFFER_SIZE
+
+// count of statx submitted at once to the io_uring of the dirent file systems (USE_IO_URING_STATX)
+#ifndef IO_URING_STATX_BATCH_SIZE
+#define IO_URING_STATX_BATCH_SIZE 256U
+#endif  // IO_URING_STATX_BATCH_SIZE
+
+// count of io_uring_enter failures (EINTR, EAGAIN, EBUSY) retried in a batch, before to fall back to the blocking stat
+#ifndef IO_URING_STATX_MAX_RETRIES
+#define IO_URING_STATX_MAX_RETRIES 16U
+#endif  // IO_URING_STATX_MAX_RETRIES
+
+///////////////////////////////
+// ASYNC DIRECTORY SCAN
+///////////////////////////////
+
+// count of files the async scan thread accumulate before publishing them to the file list
+#ifndef ASYNC_SCAN_BATCH_SIZE
+#define ASYNC_SCAN_BATCH_SIZE 1024U
+#endif  // ASYNC_SCAN_BATCH_SIZE
+
+///////////////////////////////
+// LAZY METADATA
+///////////////////////////////
+
+// count of files before and after the displayed files, for who the size and date are also requested
+#ifndef LAZY_METADATA_PREFETCH_COUNT
+#define LAZY_METADATA_PREFETCH_COUNT 64U
+#endif  // LAZY_METADATA_PREFETCH_COUNT
+
+///////////////////////////////
+// LISTING CACHE
+///////////////////////////////
+
+// max estimated memory size of the directory listings cache (FileDialogConfig::countCachedListings)
+#ifndef LISTING_CACHE_MAX_BYTES
+#define LISTING_CACHE_MAX_BYTES (64U * 1024U * 1024U)
+#endif  // LISTING_CACHE_MAX_BYTES
+
+///////////////////////////////
+// FILE INFOS STORE
+///////////////////////////////
+
+// size of the blocks where the FileInfos of a listing are allocated
+#ifndef FILE_INFOS_STORE_BLOCK_SIZE
+#define FILE_INFOS_STORE_BLOCK_SIZE (64U * 1024U)
+#endif  // FILE_INFOS_STORE_BLOCK_SIZE
+
+///////////////////////////////
+// DIRECTORY WATCH
+///////////////////////////////
+
+// size of the buffer used for read the inotify events of the watched directory (ImGuiFileDialogFlags_WatchDirectory)
+#ifndef DIRECTORY_WATCH_BUFFER_SIZE
+#define DIRECTORY_WATCH_BUFFER_SIZE (64U * 1024U)
+#endif  // DIRECTORY_WATCH_BUFFER_SIZE
+
+///////////////////////////////
+// PARALLEL SCAN
+///////////////////////////////
+
+// min count of files completed by a thread (FileDialogConfig::countScanThreads)
+#ifndef PARALLEL_SCAN_MIN_CHUNK_SIZE
+#define PARALLEL_SCAN_MIN_CHUNK_SIZE 1024U
+#endif  // PARALLEL_SCAN_MIN_CHUNK_SIZE
+
+///////////////////////////////
+// DATE FORMATING
+///////////////////////////////
+
+// max count of local times of 15 minutes buckets kept for format the dates
+#ifndef LOCAL_TIME_BUCKETS_MAX_COUNT
+#define LOCAL_TIME_BUCKETS_MAX_COUNT 4096U
+#endif  // LOCAL_TIME_BUCKETS_MAX_COUNT
+
+///////////////////////////////
+// FILTERS
+///////////////////////////////
+
+// max count of states of the dfa of a regex filter (65536 max), the regex filters needing more are searched with std::regex
+#ifndef FILTER_REGEX_DFA_MAX_STATES
+#define FILTER_REGEX_DFA_MAX_STATES 512U
+#endif  // FILTER_REGEX_DFA_MAX_STATES
+
+// max count of filters strings kept parsed for the next dialogs
+#ifndef PARSED_FILTERS_CACHE_MAX_COUNT
+#define PARSED_FILTERS_CACHE_MAX_COUNT 32U
+#endif  // PARSED_FILTERS_CACHE_MAX_COUNT
+
+///////////////////////////////
+// SEARCH
+///////////////////////////////
+
+// max count of previous search results kept for narrow the next search, or restore them on backspace
+#ifndef SEARCH_STATES_MAX_COUNT
+#define SEARCH_STATES_MAX_COUNT 16U
+#endif  // SEARCH_STATES_MAX_COUNT
+
+// min count of files scored by a thread (ImGuiFileDialogFlags_FuzzySearch)
+#ifndef FUZZY_SEARCH_MIN_CHUNK_SIZE
+#define FUZZY_SEARCH_MIN_CHUNK_SIZE 8192U
+#endif  // FUZZY_SEARCH_MIN_CHUNK_SIZE
+
+// min count of files to search for run the search in a thread (ImGuiFileDialogFlags_AsyncSearch)
+#ifndef ASYNC_SEARCH_MIN_FILES_COUNT
+#define ASYNC_SEARCH_MIN_FILES_COUNT 16384U
+#endif  // ASYNC_SEARCH_MIN_FILES_COUNT
+
+// count of files searched by the async search thread between two publications of the found ones
+#ifndef ASYNC_SEARCH_BATCH_SIZE
+#define ASYNC_SEARCH_BATCH_SIZE 16384U
+#endif  // ASYNC_SEARCH_BATCH_SIZE
+
+///////////////////////////////
+// PARALLEL SORT
+///////////////////////////////
+
+// min count of files sorted by a thread (FileDialogConfig::parallelSortThreshold)
+#ifndef PARALLEL_SORT_MIN_CHUNK_SIZE
+#define PARALLEL_SORT_MIN_CHUNK_SIZE 16384U
+#endif  // PARALLEL_SORT_MIN_CHUNK_SIZE
+
 ///////////////////////////////
 // THUMBNAILS
 ///////////////////////////////
@@ -538,54 +714,128 @@ public:
 
     std::vector<IGFD::FileInfos> ScanDirectory(const std::string& vPath) override {
         std::vector<IGFD::FileInfos> res;
-        try {
-            namespace fs = std::filesystem;
-            auto fspath = stringToPath(vPath);
-            const auto dir_iter   = fs::directory_iterator(fspath);
-            IGFD::FileType fstype = IGFD::FileType(IGFD::FileType::ContentType::Directory, fs::is_symlink(fs::status(fspath)));
-            {
-                IGFD::FileInfos file_two_dot;
-                file_two_dot.filePath    = vPath;
-                file_two_dot.fileNameExt = "..";
-                file_two_dot.fileType    = fstype;
-                res.push_back(file_two_dot);
-            }
-            for (const auto& file : dir_iter) {
-                try {
-                    IGFD::FileType fileType;
-                    if (file.is_symlink()) {
-                        fileType.SetSymLink(file.is_symlink());
-                        fileType.SetContent(IGFD::FileType::ContentType::LinkToUnknown);
-                    }
-                    if (file.is_directory()) {
-                        fileType.SetContent(IGFD::FileType::ContentType::Directory);
-                    }  // directory or symlink to directory
-                    else if (file.is_regular_file()) {
-                        fileType.SetContent(IGFD::FileType::ContentType::File);
-                    }
-                    if (fileType.isValid()) {
-                        auto fileNameExt = pathToString(file.path().filename());
-                        {
-                            IGFD::FileInfos _file;
-                            _file.filePath    = vPath;
-                            _file.fileNameExt = fileNameExt;
-                            _file.fileType    = fileType;
-                            res.push_back(_file);
-                        }
-                    }
-                } catch (const std::exception& ex) {
-                    std::cout << "IGFD : " << ex.what() << std::endl;
-                }
-            }
-        } catch (const std::exception& ex) {
-            std::cout << "IGFD : " << ex.what() << std::endl;
-        }
+        const auto path_ptr = std::make_shared<const std::string>(vPath);
+        VisitDirectory(vPath, true, [&res, &path_ptr](const IGFD::DirectoryEntry& vEntry) {
+            res.emplace_back();
+            auto& file          = res.back();
+            file.SetFilePath(path_ptr);
+            file.fileNameExt    = vEntry.fileNameExt;
+            file.fileType       = vEntry.fileType;
+            file.fileSize       = vEntry.fileSize;
+            file.fileModifTime  = vEntry.fileModifTime;
+            file.fileStatFilled = vEntry.fileStatFilled;
+            return true;
+        });
         return res;
     }
     bool IsDirectory(const std::string& vFilePathName) override {
         namespace fs = std::filesystem;
         return fs::is_directory(stringToPath(vFilePathName));
     }
+    bool GetDirectoryTimes(const std::string& vPath, int64_t& vOutModifTime, int64_t& vOutChangeTime) override {
+#ifdef _IGFD_WIN_
+        namespace fs = std::filesystem;
+        std::error_code ec;
+        const auto file_time = fs::last_write_time(stringToPath(vPath), ec);
+        if (ec) return false;
+        vOutModifTime  = (int64_t)file_time.time_since_epoch().count();  // in the file clock unit, only compared
+        vOutChangeTime = 0;
+        return true;
+#else   // _IGFD_WIN_
+        struct stat statInfos = {};
+        if (stat(vPath.c_str(), &statInfos)) return false;
+#ifdef __linux__
+        vOutModifTime  = (int64_t)statInfos.st_mtim.tv_sec * 1000000000LL + (int64_t)statInfos.st_mtim.tv_nsec;
+        vOutChangeTime = (int64_t)statInfos.st_ctim.tv_sec * 1000000000LL + (int64_t)statInfos.st_ctim.tv_nsec;
+#else   // __linux__
+        vOutModifTime  = (int64_t)statInfos.st_mtime;
+        vOutChangeTime = (int64_t)statInfos.st_ctime;
+#endif  // __linux__
+        return true;
+#endif  // _IGFD_WIN_
+    }
+
+    // the entries are given as soon as read by the directory iterator
+    // the iteration errors are reported by error codes, so the exceptions of the visitor go to the caller
+    void VisitDirectory(const std::string& vPath, bool vWithStat, const IGFD::DirectoryEntryVisitor& vVisitor) override {
+        namespace fs = std::filesystem;
+        std::error_code ec;
+        auto fspath = stringToPath(vPath);
+        auto dir_iter = fs::directory_iterator(fspath, ec);
+        if (ec) {
+            std::cout << "IGFD : " << ec.message() << std::endl;
+            return;
+        }
+        IGFD::FileType fstype = IGFD::FileType(IGFD::FileType::ContentType::Directory, fs::is_symlink(fs::status(fspath, ec)));
+        IGFD::DirectoryEntry entry;  // reused, so the name buffer is allocated only for the longer names
+        entry.fileNameExt = "..";
+        entry.fileType    = fstype;
+        if (!vVisitor(entry)) {
+            return;
+        }
+        for (const auto end_iter = fs::directory_iterator(); dir_iter != end_iter; dir_iter.increment(ec)) {
+            const auto& file = *dir_iter;
+            IGFD::FileType fileType;
+            std::error_code file_ec;  // an entry who cant be queried is skipped
+            if (file.is_symlink(file_ec)) {
+                fileType.SetSymLink(true);
+                fileType.SetContent(IGFD::FileType::ContentType::LinkToUnknown);
+            }
+            if (file.is_directory(file_ec)) {
+                fileType.SetContent(IGFD::FileType::ContentType::Directory);
+            }  // directory or symlink to directory
+            else if (file.is_regular_file(file_ec)) {
+                fileType.SetContent(IGFD::FileType::ContentType::File);
+            }
+            if (fileType.isValid()) {
+                entry.fileNameExt    = pathToString(file.path().filename());
+                entry.fileType       = fileType;
+                entry.fileSize       = 0U;
+                entry.fileModifTime  = 0;
+                entry.fileStatFilled = false;
+                if (vWithStat) {
+                    m_FillFileStat(file, entry);
+                }
+                if (!vVisitor(entry)) {
+                    return;
+                }
+            }
+        }
+        if (ec) {  // the increment failed, and the iterator is at the end
+            std::cout << "IGFD : " << ec.message() << std::endl;
+        }
+    }
+
+private:
+    // fill the size and the date of the file in the scan pass
+    static void m_FillFileStat(const std::filesystem::directory_entry& vEntry, IGFD::DirectoryEntry& vOutEntry) {
+#ifdef _IGFD_WIN_
+        // on windows, the directory_entry cache the attributes given by the directory iteration, so no more syscalls
+        namespace fs = std::filesystem;
+        std::error_code ec;
+        if (!vOutEntry.fileType.isDir()) {
+            const auto file_size = vEntry.file_size(ec);
+            if (ec) return;
+            vOutEntry.fileSize = (size_t)file_size;
+        }
+        const auto file_time = vEntry.last_write_time(ec);
+        if (ec) return;
+        // no clock_cast before c++20, so we convert via the current time of each clock
+        const auto sys_time = std::chrono::time_point_cast<std::chrono::system_clock::duration>(file_time - fs::file_time_type::clock::now() + std::chrono::system_clock::now());
+        vOutEntry.fileModifTime  = (int64_t)std::chrono::system_clock::to_time_t(sys_time);
+        vOutEntry.fileStatFilled = true;
+#else   // _IGFD_WIN_
+        // on unix, file_size and last_write_time would do a stat each, so we do only one
+        struct stat statInfos = {};
+        if (!stat(vEntry.path().c_str(), &statInfos)) {
+            if (!vOutEntry.fileType.isDir()) {
+                vOutEntry.fileSize = (size_t)statInfos.st_size;
+            }
+            vOutEntry.fileModifTime  = (int64_t)statInfos.st_mtime;
+            vOutEntry.fileStatFilled = true;
+        }
+#endif  // _IGFD_WIN_
+    }
 };
 #define FILE_SYSTEM_OVERRIDE FileSystemStd
 #else
@@ -722,71 +972,359 @@ public:
 
     std::vector<IGFD::FileInfos> ScanDirectory(const std::string& vPath) override {
         std::vector<IGFD::FileInfos> res;
-        struct dirent** files = nullptr;
-        size_t n              = scandir(vPath.c_str(), &files, nullptr,                         //
-                                        [](const struct dirent** a, const struct dirent** b) {  //
-                               return strcoll((*a)->d_name, (*b)->d_name);
-                           });
-        if (n && files) {
-            for (size_t i = 0; i < n; ++i) {
-                struct dirent* ent = files[i];
-                IGFD::FileType fileType;
-                switch (ent->d_type) {
-                    case DT_DIR: fileType.SetContent(IGFD::FileType::ContentType::Directory); break;
-                    case DT_REG: fileType.SetContent(IGFD::FileType::ContentType::File); break;
-#if defined(_IGFD_UNIX_) || (DT_LNK != DT_UNKNOWN)
-                    case DT_LNK:
+        const auto path_ptr = std::make_shared<const std::string>(vPath);
+        VisitDirectory(vPath, true, [&res, &path_ptr](const IGFD::DirectoryEntry& vEntry) {
+            res.emplace_back();
+            auto& file          = res.back();
+            file.SetFilePath(path_ptr);
+            file.fileNameExt    = vEntry.fileNameExt;
+            file.fileType       = vEntry.fileType;
+            file.fileSize       = vEntry.fileSize;
+            file.fileModifTime  = vEntry.fileModifTime;
+            file.fileStatFilled = vEntry.fileStatFilled;
+            return true;
+        });
+        return res;
+    }
+    bool IsDirectory(const std::string& vFilePathName) override {
+        DIR *pDir = opendir(vFilePathName.c_str());
+        if (pDir) {
+            (void)closedir(pDir);
+            return true;
+        }
+        return false;
+    }
+    bool GetDirectoryTimes(const std::string& vPath, int64_t& vOutModifTime, int64_t& vOutChangeTime) override {
+        struct stat statInfos = {};
+        if (stat(vPath.c_str(), &statInfos)) return false;
+#ifdef __linux__
+        vOutModifTime  = (int64_t)statInfos.st_mtim.tv_sec * 1000000000LL + (int64_t)statInfos.st_mtim.tv_nsec;
+        vOutChangeTime = (int64_t)statInfos.st_ctim.tv_sec * 1000000000LL + (int64_t)statInfos.st_ctim.tv_nsec;
+#else   // __linux__
+        vOutModifTime  = (int64_t)statInfos.st_mtime;
+        vOutChangeTime = (int64_t)statInfos.st_ctime;
+#endif  // __linux__
+        return true;
+    }
+
+    // the entries are given once all read, stat and sorted, in the same order as scandir with strcoll before
+    // without vWithStat, only the links and the entries of unknown type are stat, for get their type
+    void VisitDirectory(const std::string& vPath, bool vWithStat, const IGFD::DirectoryEntryVisitor& vVisitor) override {
+        DIR* dir = opendir(vPath.c_str());
+        if (dir != nullptr) {
+#ifdef _IGFD_UNIX_
+            const int dir_fd = dirfd(dir);  // for stat the entries relatively to the opened directory
+#else
+            const int dir_fd = -1;
 #endif
-                    case DT_UNKNOWN: {
-                        struct stat sb = {};
-#ifdef _IGFD_WIN_
-                        auto filePath  = vPath + ent->d_name;
+            std::vector<IGFD::DirectoryEntry> entries;
+            std::vector<int> types;
+            struct dirent* ent = nullptr;
+            while ((ent = readdir(dir)) != nullptr) {
+                entries.emplace_back();
+                entries.back().fileNameExt = ent->d_name;
+                types.push_back(ent->d_type);
+            }
+            m_CompleteEntries(vPath, dir_fd, types, vWithStat, entries);
+            (void)closedir(dir);
+            std::sort(entries.begin(), entries.end(), [](const IGFD::DirectoryEntry& a, const IGFD::DirectoryEntry& b) {  //
+                return strcoll(a.fileNameExt.c_str(), b.fileNameExt.c_str()) < 0;
+            });
+            for (const auto& entry : entries) {
+                if (!vVisitor(entry)) {
+                    break;
+                }
+            }
+        }
+    }
+
+protected:
+
+    // one stat per entry, for the type of links and the size and date of all entries
+    // vDirFd is the fd of the opened directory on unix (for stat relatively to it), ignored on windows
+    static bool m_StatEntry(const std::string& vPath, int vDirFd, const std::string& vName, struct stat& vOutStat) {
+#ifdef _IGFD_UNIX_
+        (void)vPath;
+        return !fstatat(vDirFd, vName.c_str(), &vOutStat, 0);  // follow the symlinks, like stat
 #else
-                        auto filePath = vPath + IGFD::Utils::GetPathSeparator() + ent->d_name;
+        (void)vDirFd;
+        return !stat((vPath + IGFD::Utils::GetPathSeparator() + vName).c_str(), &vOutStat);
 #endif
-                        if (!stat(filePath.c_str(), &sb)) {
-                            if (sb.st_mode & S_IFLNK) {
-                                fileType.SetSymLink(true);
-                                // by default if we can't figure out the target type.
-                                fileType.SetContent(IGFD::FileType::ContentType::LinkToUnknown);
-                            }
-                            if (sb.st_mode & S_IFREG) {
-                                fileType.SetContent(IGFD::FileType::ContentType::File);
-                                break;
-                            } else if (sb.st_mode & S_IFDIR) {
-                                fileType.SetContent(IGFD::FileType::ContentType::Directory);
-                                break;
-                            }
-                        }
+    }
+
+    // fill the type, size and date of an entry from its dirent type and its stat (nullptr if the stat failed)
+    // return false if the entry is not a file, a dir or a link
+    static bool m_FillEntry(int vType, const struct stat* vStatPtr, IGFD::DirectoryEntry& vOutEntry) {
+        IGFD::FileType fileType;
+        switch (vType) {
+            case DT_DIR: fileType.SetContent(IGFD::FileType::ContentType::Directory); break;
+            case DT_REG: fileType.SetContent(IGFD::FileType::ContentType::File); break;
+#if defined(_IGFD_UNIX_) || (DT_LNK != DT_UNKNOWN)
+            case DT_LNK:
+#endif
+            case DT_UNKNOWN: {
+                if (vStatPtr != nullptr) {
+                    if (vStatPtr->st_mode & S_IFLNK) {
+                        fileType.SetSymLink(true);
+                        // by default if we can't figure out the target type.
+                        fileType.SetContent(IGFD::FileType::ContentType::LinkToUnknown);
+                    }
+                    if (vStatPtr->st_mode & S_IFREG) {
+                        fileType.SetContent(IGFD::FileType::ContentType::File);
+                        break;
+                    } else if (vStatPtr->st_mode & S_IFDIR) {
+                        fileType.SetContent(IGFD::FileType::ContentType::Directory);
                         break;
                     }
-                    default: break;  // leave it invalid (devices, etc.)
-                }
-                if (fileType.isValid()) {
-                    IGFD::FileInfos _file;
-                    _file.filePath    = vPath;
-                    _file.fileNameExt = ent->d_name;
-                    _file.fileType    = fileType;
-                    res.push_back(_file);
                 }
+                break;
             }
-            for (size_t i = 0; i < n; ++i) {
-                free(files[i]);
+            default: break;  // leave it invalid (devices, etc.)
+        }
+        if (!fileType.isValid()) {
+            return false;
+        }
+        vOutEntry.fileType = fileType;
+        if (vStatPtr != nullptr) {
+            if (!fileType.isDir()) {
+                vOutEntry.fileSize = (size_t)vStatPtr->st_size;
             }
-            free(files);
+            vOutEntry.fileModifTime  = (int64_t)vStatPtr->st_mtime;
+            vOutEntry.fileStatFilled = true;
         }
-        return res;
+        return true;
     }
-    bool IsDirectory(const std::string& vFilePathName) override {
-        DIR *pDir = opendir(vFilePathName.c_str());
-        if (pDir) {
-            (void)closedir(pDir);
-            return true;
+
+    // stat the entries read from the directory (only the names are filled) and fill their type, size and date
+    // vTypes are the dirent types of the entries. the entries who are not a file, a dir or a link are removed
+    // with USE_IO_URING_STATX the stats are batched with io_uring, else it's a blocking stat per entry
+    // without vWithStat, only the entries who need a stat for know their type are stat (links, unknown types)
+    static void m_CompleteEntries(const std::string& vPath, int vDirFd, const std::vector<int>& vTypes, bool vWithStat, std::vector<IGFD::DirectoryEntry>& vInOutFiles) {
+        const size_t count = vInOutFiles.size();
+        std::vector<struct stat> stats(count);
+        std::vector<char> statOks(count, 0);
+#ifdef _IGFD_IO_URING_STATX_
+        if (vWithStat) {
+            IoUringStatx ring(IO_URING_STATX_BATCH_SIZE);
+            ring.StatEntries(vDirFd, vInOutFiles, stats, statOks);  // do nothing if io_uring is not available
+        }
+#endif  // _IGFD_IO_URING_STATX_
+        size_t validCount = 0U;
+        for (size_t idx = 0U; idx < count; ++idx) {
+            auto& file = vInOutFiles[idx];
+            if (!statOks[idx] && (vWithStat || (vTypes[idx] != DT_DIR && vTypes[idx] != DT_REG))) {  // the blocking path, or the fallback if io_uring failed for this entry
+                statOks[idx] = m_StatEntry(vPath, vDirFd, file.fileNameExt, stats[idx]);
+            }
+            if (m_FillEntry(vTypes[idx], statOks[idx] ? &stats[idx] : nullptr, file)) {
+                if (validCount != idx) {
+                    vInOutFiles[validCount] = std::move(file);
+                }
+                ++validCount;
+            }
         }
-        return false;
+        vInOutFiles.resize(validCount);
+    }
+
+#ifdef _IGFD_IO_URING_STATX_
+    // a minimal io_uring (no liburing dependency) who only submit statx requests and reap their completions
+    class IoUringStatx {
+    private:
+        int m_RingFd             = -1;
+        unsigned m_BatchSize     = 0U;
+        void* m_SqRingPtr        = MAP_FAILED;
+        size_t m_SqRingSize      = 0U;
+        void* m_CqRingPtr        = MAP_FAILED;
+        size_t m_CqRingSize      = 0U;
+        io_uring_sqe* m_SqesPtr  = nullptr;
+        size_t m_SqesSize        = 0U;
+        unsigned* m_SqTailPtr    = nullptr;
+        unsigned* m_SqMaskPtr    = nullptr;
+        unsigned* m_SqArrayPtr   = nullptr;
+        unsigned* m_CqHeadPtr    = nullptr;
+        unsigned* m_CqTailPtr    = nullptr;
+        unsigned* m_CqMaskPtr    = nullptr;
+        io_uring_cqe* m_CqesPtr  = nullptr;
+
+    public:
+        explicit IoUringStatx(unsigned vEntries) {
+            io_uring_params params = {};
+            m_RingFd = (int)syscall(__NR_io_uring_setup, vEntries, &params);
+            if (m_RingFd < 0) {
+                return;  // kernel without io_uring or io_uring disabled (seccomp, sysctl)
+            }
+            m_SqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+            m_CqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+            const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+            if (single_mmap) {
+                m_SqRingSize = m_CqRingSize = (std::max)(m_SqRingSize, m_CqRingSize);
+            }
+            m_SqRingPtr = mmap(nullptr, m_SqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_RingFd, IORING_OFF_SQ_RING);
+            if (m_SqRingPtr == MAP_FAILED) {
+                return;
+            }
+            if (!single_mmap) {
+                m_CqRingPtr = mmap(nullptr, m_CqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_RingFd, IORING_OFF_CQ_RING);
+                if (m_CqRingPtr == MAP_FAILED) {
+                    return;
+                }
+            }
+            m_SqesSize    = params.sq_entries * sizeof(io_uring_sqe);
+            void* sqesPtr = mmap(nullptr, m_SqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_RingFd, IORING_OFF_SQES);
+            if (sqesPtr == MAP_FAILED) {
+                return;
+            }
+            auto* sq     = static_cast<char*>(m_SqRingPtr);
+            auto* cq     = static_cast<char*>(single_mmap ? m_SqRingPtr : m_CqRingPtr);
+            m_SqesPtr    = static_cast<io_uring_sqe*>(sqesPtr);
+            m_SqTailPtr  = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+            m_SqMaskPtr  = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+            m_SqArrayPtr = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+            m_CqHeadPtr  = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+            m_CqTailPtr  = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+            m_CqMaskPtr  = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+            m_CqesPtr    = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+            m_BatchSize  = params.sq_entries;  // the cq ring is at least as big
+        }
+
+        ~IoUringStatx() {
+            if (m_SqesPtr != nullptr) {
+                munmap(m_SqesPtr, m_SqesSize);
+            }
+            if (m_CqRingPtr != MAP_FAILED) {
+                munmap(m_CqRingPtr, m_CqRingSize);
+            }
+            if (m_SqRingPtr != MAP_FAILED) {
+                munmap(m_SqRingPtr, m_SqRingSize);
+            }
+            if (m_RingFd >= 0) {
+                close(m_RingFd);
+            }
+        }
+
+        IoUringStatx(const IoUringStatx&)            = delete;
+        IoUringStatx& operator=(const IoUringStatx&) = delete;
+
+        bool IsValid() const {
+            return m_CqesPtr != nullptr;
+        }
+
+        // statx all the entries relatively to vDirFd, vOutStatOks[i] is false for the entries who failed
+        // (io_uring not available, kernel without IORING_OP_STATX, missing file..) so the caller can stat them again
+        void StatEntries(int vDirFd, const std::vector<IGFD::DirectoryEntry>& vFiles, std::vector<struct stat>& vOutStats, std::vector<char>& vOutStatOks) {
+            if (!IsValid()) {
+                return;
+            }
+            std::unique_ptr<struct statx[]> statxs(new struct statx[m_BatchSize]);
+            for (size_t start = 0U; start < vFiles.size(); start += m_BatchSize) {
+                const unsigned count = (unsigned)(std::min)((size_t)m_BatchSize, vFiles.size() - start);
+                unsigned tail        = *m_SqTailPtr;
+                for (unsigned i = 0U; i < count; ++i) {
+                    const unsigned idx = tail & *m_SqMaskPtr;
+                    io_uring_sqe* sqe  = &m_SqesPtr[idx];
+                    memset(sqe, 0, sizeof(io_uring_sqe));
+                    sqe->opcode      = IORING_OP_STATX;
+                    sqe->fd          = vDirFd;
+                    sqe->addr        = (uint64_t)(uintptr_t)vFiles[start + i].fileNameExt.c_str();
+                    sqe->len         = STATX_TYPE | STATX_MODE | STATX_SIZE | STATX_MTIME;
+                    sqe->off         = (uint64_t)(uintptr_t)&statxs[i];
+                    sqe->statx_flags = 0;  // follow the symlinks, like stat
+                    sqe->user_data   = i;
+                    m_SqArrayPtr[idx] = idx;
+                    ++tail;
+                }
+                __atomic_store_n(m_SqTailPtr, tail, __ATOMIC_RELEASE);
+                unsigned toSubmit = count;
+                unsigned reaped   = 0U;
+                unsigned retries  = 0U;
+                while (reaped < count) {
+                    const long ret = syscall(__NR_io_uring_enter, m_RingFd, toSubmit, count - reaped, IORING_ENTER_GETEVENTS, nullptr, 0);
+                    if (ret >= 0) {
+                        toSubmit -= (std::min)(toSubmit, (unsigned)ret);
+                    } else if ((errno != EINTR && errno != EAGAIN && errno != EBUSY) || ++retries > IO_URING_STATX_MAX_RETRIES) {
+                        // unusable ring, the blocking path will stat the remaining entries
+                        // but the requests in flight write in statxs, so they are waited once before
+                        const unsigned inFlight = (count - toSubmit) - reaped;
+                        if (inFlight > 0U && syscall(__NR_io_uring_enter, m_RingFd, 0U, inFlight, IORING_ENTER_GETEVENTS, nullptr, 0) < 0) {
+                            (void)statxs.release();  // leaked, since maybe still written by the kernel
+                        }
+                        m_CqesPtr = nullptr;
+                        return;
+                    }
+                    // reaped even after a failure, since EAGAIN and EBUSY can mean than the completion queue is full
+                    unsigned head = *m_CqHeadPtr;
+                    while (head != __atomic_load_n(m_CqTailPtr, __ATOMIC_ACQUIRE)) {
+                        const io_uring_cqe* cqe = &m_CqesPtr[head & *m_CqMaskPtr];
+                        const size_t i          = start + (size_t)cqe->user_data;
+                        if (cqe->res == 0) {
+                            const struct statx& stx = statxs[(size_t)cqe->user_data];
+                            struct stat& sb         = vOutStats[i];
+                            sb.st_mode              = stx.stx_mode;
+                            sb.st_size              = (off_t)stx.stx_size;
+                            sb.st_mtime             = (time_t)stx.stx_mtime.tv_sec;
+                            vOutStatOks[i]          = 1;
+                        }
+                        ++head;
+                        ++reaped;
+                    }
+                    __atomic_store_n(m_CqHeadPtr, head, __ATOMIC_RELEASE);
+                }
+            }
+        }
+    };
+#endif  // _IGFD_IO_URING_STATX_
+};
+#if defined(USE_GETDENTS_FILESYSTEM) && defined(__linux__)
+// linux only, read the raw entries of a directory with getdents64 in one big buffer reused between scans
+// so no allocation per dirent like with readdir/scandir, and no sort since the FileManager sort the list anyway
+// the entries of each buffer fill are stat together, then given to the visitor
+class FileSystemGetdents : public FileSystemDirent {
+private:
+    struct LinuxDirent64 {  // the record layout of getdents64
+        uint64_t d_ino;
+        int64_t d_off;
+        unsigned short d_reclen;
+        unsigned char d_type;
+        char d_name[1];  // null terminated, the real size is given by d_reclen
+    };
+
+public:
+    void VisitDirectory(const std::string& vPath, bool vWithStat, const IGFD::DirectoryEntryVisitor& vVisitor) override {
+        const int dir_fd = open(vPath.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (dir_fd < 0) {
+            return;
+        }
+        // one buffer per thread, since the async scan and the path popup can scan at the same time
+        static thread_local std::vector<char> s_Buffer(GETDENTS_BUFFER_SIZE);
+        std::vector<IGFD::DirectoryEntry> entries;
+        std::vector<int> types;
+        bool is_stopped = false;
+        long count      = 0;
+        // a failure end the scan with the entries already given, like a failure of readdir in FileSystemDirent
+        while (!is_stopped && (count = syscall(SYS_getdents64, dir_fd, s_Buffer.data(), s_Buffer.size())) > 0) {
+            entries.clear();
+            types.clear();
+            for (long pos = 0; pos < count;) {
+                const auto* ent = reinterpret_cast<const LinuxDirent64*>(s_Buffer.data() + pos);
+                entries.emplace_back();
+                entries.back().fileNameExt = ent->d_name;
+                types.push_back(ent->d_type);
+                pos += ent->d_reclen;
+            }
+            m_CompleteEntries(vPath, dir_fd, types, vWithStat, entries);
+            for (const auto& entry : entries) {
+                if (!vVisitor(entry)) {
+                    is_stopped = true;
+                    break;
+                }
+            }
+        }
+        (void)close(dir_fd);
     }
 };
+#define FILE_SYSTEM_OVERRIDE FileSystemGetdents
+#else  // USE_GETDENTS_FILESYSTEM
 #define FILE_SYSTEM_OVERRIDE FileSystemDirent
+#endif  // USE_GETDENTS_FILESYSTEM
 #endif  // USE_STD_FILESYSTEM
 #else
 #include CUSTOM_FILESYSTEM_INCLUDE
@@ -941,7 +1479,7 @@ std::string IGFD::Utils::LowerCaseString(const std::string& vString) {
 
     // convert to lower case
     for (char& c : str) {
-        c = (char)std::tolower(c);
+        c = (char)std::tolower((unsigned char)c);  // a negative char is UB
     }
 
     return str;
@@ -1061,6 +1599,33 @@ bool IGFD::Utils::M_ExtractNumFromStringAtPos(const std::string& str, size_t& po
     return false;
 }
 
+// a key who sort the strings like NaturalCompare in insensitive case, with a simple comparison of bytes
+// the chars are lowered, and a number is a '0' followed by the 8 bytes big endian of the double, transformed for keep the order
+// so the numbers are sorted by value between them, and before the letters like their digits
+std::string IGFD::Utils::GetNaturalSortKey(const std::string& vString) {
+    std::string res;
+    res.reserve(vString.size() + 16U);
+    size_t pos = 0U;
+    double num = 0.0;
+    while (pos < vString.size()) {
+        size_t num_pos = pos;
+        if (M_ExtractNumFromStringAtPos(vString, num_pos, num)) {
+            uint64_t bits = 0U;
+            memcpy(&bits, &num, sizeof(bits));
+            bits = (bits & (1ULL << 63U)) ? ~bits : (bits | (1ULL << 63U));  // the negatives are reversed, the positives after them
+            res.push_back('0');
+            for (int shift = 56; shift >= 0; shift -= 8) {
+                res.push_back((char)((bits >> shift) & 0xFFU));
+            }
+            pos = num_pos;
+        } else {
+            res.push_back((char)std::tolower((unsigned char)vString[pos]));
+            ++pos;
+        }
+    }
+    return res;
+}
+
 // Fonction de comparaison naturelle entre deux cha�nes
 bool IGFD::Utils::NaturalCompare(const std::string& vA, const std::string& vB, bool vInsensitiveCase, bool vDescending) {
     std::size_t ia = 0, ib = 0;
@@ -1068,8 +1633,8 @@ bool IGFD::Utils::NaturalCompare(const std::string& vA, const std::string& vB, b
     const auto& as = vA.size();
     const auto& bs = vB.size();
     while (ia < as && ib < bs) {
-        const char& ca = vInsensitiveCase ? std::tolower(vA[ia]) : vA[ia];
-        const char& cb = vInsensitiveCase ? std::tolower(vB[ib]) : vB[ib];
+        const char& ca = vInsensitiveCase ? (char)std::tolower((unsigned char)vA[ia]) : vA[ia];
+        const char& cb = vInsensitiveCase ? (char)std::tolower((unsigned char)vB[ib]) : vB[ib];
         // we cannot start a number extraction from suffixs
         const auto rA = M_ExtractNumFromStringAtPos(vA, ia, nA);
         const auto rB = M_ExtractNumFromStringAtPos(vB, ib, nB);
@@ -1088,6 +1653,120 @@ bool IGFD::Utils::NaturalCompare(const std::string& vA, const std::string& vB, b
     return vDescending ? as > bs : as < bs;  // toto1 < toto1+
 }
 
+// the workers of ParallelFor, started at the first use and shared by all the callers (the main thread, the scan thread..)
+// a job is split in chunks claimed one by one by the caller and the free workers, so a worker busy with another job, or a ParallelFor
+// called from a chunk, never wait for a chunk nobody run. the pool is never deleted, so a scan thread can still use it at exit
+class ParallelForPool {
+public:
+    struct Job {
+        const std::function<void(size_t, size_t)>* funcPtr = nullptr;
+        size_t count         = 0U;
+        size_t chunkSize     = 0U;
+        size_t chunksCount   = 0U;
+        std::atomic<size_t> nextChunk{0U};  // the next chunk to claim
+        std::mutex mutex;                   // protect countDoneChunks and exceptionPtr
+        std::condition_variable doneCondition;
+        size_t countDoneChunks = 0U;
+        std::exception_ptr exceptionPtr = nullptr;  // the first exception of the chunks, rethrown to the caller
+    };
+
+    static ParallelForPool& Instance() {
+        static auto* s_PoolPtr = new ParallelForPool();  // never deleted
+        return *s_PoolPtr;
+    }
+
+    void Run(const std::shared_ptr<Job>& vJobPtr) {
+        m_EnsureWorkers();
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Jobs.push_back(vJobPtr);
+        }
+        m_Condition.notify_all();
+        M_RunChunks(*vJobPtr);
+        m_RemoveJob(vJobPtr);  // all the chunks are claimed
+        std::unique_lock<std::mutex> lock(vJobPtr->mutex);
+        vJobPtr->doneCondition.wait(lock, [&vJobPtr]() { return vJobPtr->countDoneChunks == vJobPtr->chunksCount; });
+        if (vJobPtr->exceptionPtr != nullptr) {
+            std::rethrow_exception(vJobPtr->exceptionPtr);
+        }
+    }
+
+private:
+    std::mutex m_Mutex;  // protect m_Jobs and m_CountWorkers
+    std::condition_variable m_Condition;
+    std::list<std::shared_ptr<Job> > m_Jobs;  // the jobs with chunks to claim
+    size_t m_CountWorkers = 0U;
+
+    void m_EnsureWorkers() {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_CountWorkers == 0U) {
+            m_CountWorkers = (std::max)(1U, std::thread::hardware_concurrency()) - 1U;  // the caller is the last one
+            for (size_t idx = 0U; idx < m_CountWorkers; ++idx) {
+                std::thread(&ParallelForPool::m_WorkerFunc, this).detach();
+            }
+        }
+    }
+
+    void m_RemoveJob(const std::shared_ptr<Job>& vJobPtr) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Jobs.remove(vJobPtr);
+    }
+
+    void m_WorkerFunc() {
+        while (true) {
+            std::shared_ptr<Job> job_ptr;
+            {
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                m_Condition.wait(lock, [this]() { return !m_Jobs.empty(); });
+                job_ptr = m_Jobs.front();
+            }
+            M_RunChunks(*job_ptr);
+            m_RemoveJob(job_ptr);
+        }
+    }
+
+    static void M_RunChunks(Job& vJob) {
+        size_t chunk_idx = 0U;
+        while ((chunk_idx = vJob.nextChunk++) < vJob.chunksCount) {
+            std::exception_ptr exception_ptr = nullptr;
+            try {
+                const size_t start = chunk_idx * vJob.chunkSize;
+                (*vJob.funcPtr)(start, (std::min)(start + vJob.chunkSize, vJob.count));
+            } catch (...) {
+                exception_ptr = std::current_exception();
+            }
+            std::lock_guard<std::mutex> lock(vJob.mutex);
+            if (vJob.exceptionPtr == nullptr) {
+                vJob.exceptionPtr = exception_ptr;
+            }
+            if (++vJob.countDoneChunks == vJob.chunksCount) {
+                vJob.doneCondition.notify_all();
+            }
+        }
+    }
+};
+
+void IGFD::Utils::ParallelFor(size_t vCount, size_t vThreadsCount, size_t vMinChunkSize, const std::function<void(size_t, size_t)>& vFunc) {
+    if (vCount == 0U || !vFunc) {
+        return;
+    }
+    if (vThreadsCount == 0U) {
+        vThreadsCount = (std::max)(1U, std::thread::hardware_concurrency());
+    }
+    // no more chunks than needed, a thread for a few entries cost more than it save
+    const size_t max_chunks   = (vCount + (std::max)(vMinChunkSize, (size_t)1U) - 1U) / (std::max)(vMinChunkSize, (size_t)1U);
+    const size_t chunks_count = (std::min)(vThreadsCount, max_chunks);
+    if (chunks_count <= 1U) {
+        vFunc(0U, vCount);
+        return;
+    }
+    auto job_ptr         = std::make_shared<ParallelForPool::Job>();
+    job_ptr->funcPtr     = &vFunc;
+    job_ptr->count       = vCount;
+    job_ptr->chunkSize   = (vCount + chunks_count - 1U) / chunks_count;
+    job_ptr->chunksCount = (vCount + job_ptr->chunkSize - 1U) / job_ptr->chunkSize;
+    ParallelForPool::Instance().Run(job_ptr);
+}
 
 IGFD::FileStyle::FileStyle() : color(0, 0, 0, 0) {
 }
@@ -1111,7 +1790,7 @@ void IGFD::SearchManager::DrawSearchBar(FileDialogInternal& vFileDialogInternal)
     // search field
     if (IMGUI_BUTTON(resetButtonString "##BtnImGuiFileDialogSearchField")) {
         Clear();
-        vFileDialogInternal.fileManager.ApplyFilteringOnFileList(vFileDialogInternal);
+        vFileDialogInternal.fileManager.ApplySearchOnFileList(vFileDialogInternal);
     }
     if (ImGui::IsItemHovered()) ImGui::SetTooltip(buttonResetSearchString);
     ImGui::SameLine();
@@ -1123,20 +1802,433 @@ void IGFD::SearchManager::DrawSearchBar(FileDialogInternal& vFileDialogInternal)
     ImGui::PopItemWidth();
     if (edited) {
         searchTag = searchBuffer;
-        vFileDialogInternal.fileManager.ApplyFilteringOnFileList(vFileDialogInternal);
+        vFileDialogInternal.fileManager.ApplySearchOnFileList(vFileDialogInternal);
     }
 }
 
-void IGFD::FilterInfos::setCollectionTitle(const std::string& vTitle) {
-    title = vTitle;
-}
+// a regex is compiled in a nfa (thompson construction), then in a dfa searched in one pass without allocation.
+// only the regular subset is supported (chars, escapes, classes, groups, alternations, * + ? and the ^ $ anchors),
+// the other regexs (bounded repetitions, back references, lookarounds, ...) are searched with std::regex
+class RegexNfa {
+public:
+    enum class StateType : uint8_t { Chars = 0, Epsilon, Split, Begin, End, Match };
+    struct State {
+        StateType type = StateType::Epsilon;
+        std::bitset<256> chars;  // for StateType::Chars
+        int32_t out  = -1;
+        int32_t out1 = -1;  // for StateType::Split
+    };
 
-void IGFD::FilterInfos::addFilter(const std::string& vFilter, const bool& vIsRegex) {
-    setCollectionTitle(vFilter);
-    addCollectionFilter(vFilter, vIsRegex);
-}
+public:
+    std::vector<State> states;
+    int32_t start = -1;
+    bool isSupported = true;
 
-void IGFD::FilterInfos::addCollectionFilter(const std::string& vFilter, const bool& vIsRegex) {
+private:
+    struct Fragment {
+        int32_t start;
+        int32_t end;  // an epsilon state to connect
+    };
+    const std::string& m_Regex;
+    size_t m_Pos = 0U;
+
+public:
+    explicit RegexNfa(const std::string& vRegex) : m_Regex(vRegex) {
+        auto frag = m_ParseAlternation();
+        if (m_Pos != m_Regex.size()) {  // a ')' without '('
+            isSupported = false;
+        }
+        if (isSupported) {
+            states[frag.end].out = m_AddState(StateType::Match);
+            start                = frag.start;
+        }
+    }
+
+private:
+    int32_t m_AddState(StateType vType, int32_t vOut = -1, int32_t vOut1 = -1) {
+        State state;
+        state.type = vType;
+        state.out  = vOut;
+        state.out1 = vOut1;
+        states.push_back(state);
+        return (int32_t)states.size() - 1;
+    }
+    Fragment m_AddChars(const std::bitset<256>& vChars) {
+        const auto end            = m_AddState(StateType::Epsilon);
+        const auto chars_state    = m_AddState(StateType::Chars, end);
+        states[chars_state].chars = vChars;
+        return {chars_state, end};
+    }
+    Fragment m_AddEmpty() {
+        const auto state = m_AddState(StateType::Epsilon);
+        return {state, state};
+    }
+    char m_Peek() const {
+        return (m_Pos < m_Regex.size()) ? m_Regex[m_Pos] : '\0';
+    }
+    bool m_IsEnd() const {
+        return m_Pos >= m_Regex.size();
+    }
+    Fragment m_ParseAlternation() {
+        auto frag = m_ParseConcatenation();
+        while (isSupported && !m_IsEnd() && m_Peek() == '|') {
+            ++m_Pos;
+            const auto other = m_ParseConcatenation();
+            const auto end        = m_AddState(StateType::Epsilon);
+            states[frag.end].out  = end;
+            states[other.end].out = end;
+            frag                  = {m_AddState(StateType::Split, frag.start, other.start), end};
+        }
+        return frag;
+    }
+    Fragment m_ParseConcatenation() {
+        auto frag = m_AddEmpty();
+        while (isSupported && !m_IsEnd() && m_Peek() != '|' && m_Peek() != ')') {
+            const auto next      = m_ParseRepetition();
+            states[frag.end].out = next.start;
+            frag.end             = next.end;
+        }
+        return frag;
+    }
+    Fragment m_ParseRepetition() {
+        auto frag = m_ParseAtom();
+        while (isSupported && !m_IsEnd()) {
+            const char c = m_Peek();
+            if (c == '*' || c == '+' || c == '?') {
+                ++m_Pos;
+                const auto end = m_AddState(StateType::Epsilon);
+                if (c == '*') {
+                    const auto split     = m_AddState(StateType::Split, frag.start, end);
+                    states[frag.end].out = split;
+                    frag                 = {split, end};
+                } else if (c == '+') {
+                    const auto split     = m_AddState(StateType::Split, frag.start, end);
+                    states[frag.end].out = split;
+                    frag.end             = end;
+                } else {
+                    states[frag.end].out = end;
+                    frag                 = {m_AddState(StateType::Split, frag.start, end), end};
+                }
+                if (m_Peek() == '?') {  // lazy, same found or not
+                    ++m_Pos;
+                }
+            } else if (c == '{') {  // bounded repetition
+                isSupported = false;
+            } else {
+                break;
+            }
+        }
+        return frag;
+    }
+    Fragment m_ParseAtom() {
+        std::bitset<256> chars;
+        const char c = m_Regex[m_Pos++];
+        switch (c) {
+            case '(': {
+                if (m_Peek() == '?') {
+                    if (m_Pos + 1U < m_Regex.size() && m_Regex[m_Pos + 1U] == ':') {
+                        m_Pos += 2U;  // non capturing group
+                    } else {
+                        isSupported = false;  // lookaround
+                        return m_AddEmpty();
+                    }
+                }
+                const auto frag = m_ParseAlternation();
+                if (m_Peek() != ')') {
+                    isSupported = false;
+                } else {
+                    ++m_Pos;
+                }
+                return frag;
+            }
+            case '[': m_ParseClass(chars); return m_AddChars(chars);
+            case '.':
+                chars.set();
+                chars.reset('\n');
+                chars.reset('\r');
+                return m_AddChars(chars);
+            case '^': {
+                const auto end = m_AddState(StateType::Epsilon);
+                return {m_AddState(StateType::Begin, end), end};
+            }
+            case '$': {
+                const auto end = m_AddState(StateType::Epsilon);
+                return {m_AddState(StateType::End, end), end};
+            }
+            case '\\':
+                if (!m_ParseEscape(chars, false)) {
+                    isSupported = false;
+                }
+                return m_AddChars(chars);
+            case '*':
+            case '+':
+            case '?':
+            case '{':
+            case '}':
+            case ']':
+            case ')': isSupported = false; return m_AddEmpty();
+            default: chars.set((uint8_t)c); return m_AddChars(chars);
+        }
+    }
+    // the escape after a '\'
+    bool m_ParseEscape(std::bitset<256>& vChars, bool vInClass) {
+        if (m_IsEnd()) {
+            return false;
+        }
+        const char c = m_Regex[m_Pos++];
+        std::bitset<256> chars;
+        switch (c) {
+            case 'd':
+            case 'D':
+                for (int i = '0'; i <= '9'; ++i) chars.set(i);
+                break;
+            case 'w':
+            case 'W':
+                for (int i = 0; i < 256; ++i) {
+                    if ((i >= 'a' && i <= 'z') || (i >= 'A' && i <= 'Z') || (i >= '0' && i <= '9') || i == '_') chars.set(i);
+                }
+                break;
+            case 's':
+            case 'S':
+                for (const char s : {' ', '\t', '\n', '\v', '\f', '\r'}) chars.set((uint8_t)s);
+                break;
+            case 'n': chars.set('\n'); break;
+            case 'r': chars.set('\r'); break;
+            case 't': chars.set('\t'); break;
+            case 'f': chars.set('\f'); break;
+            case 'v': chars.set('\v'); break;
+            default:
+                if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')) {
+                    return false;  // back reference, word boundary, hexa, unicode, ...
+                }
+                chars.set((uint8_t)c);
+                break;
+        }
+        if (c == 'D' || c == 'W' || c == 'S') {
+            if (vInClass) {
+                return false;
+            }
+            chars.flip();
+        }
+        vChars |= chars;
+        return true;
+    }
+    // a class after a '['
+    void m_ParseClass(std::bitset<256>& vChars) {
+        const bool is_negated = (m_Peek() == '^');
+        if (is_negated) {
+            ++m_Pos;
+        }
+        while (isSupported && !m_IsEnd() && m_Peek() != ']') {
+            int low = 0;
+            if (!m_ParseClassChar(vChars, low)) {
+                return;
+            }
+            if (low < 0) {  // an escaped class, like \d
+                continue;
+            }
+            if (m_Peek() == '-' && m_Pos + 1U < m_Regex.size() && m_Regex[m_Pos + 1U] != ']') {
+                ++m_Pos;
+                int high = 0;
+                if (!m_ParseClassChar(vChars, high) || high < 0 || high < low) {
+                    isSupported = false;
+                    return;
+                }
+                for (int i = low; i <= high; ++i) {
+                    vChars.set(i);
+                }
+            } else {
+                vChars.set(low);
+            }
+        }
+        if (m_IsEnd()) {
+            isSupported = false;
+            return;
+        }
+        ++m_Pos;  // ']'
+        if (is_negated) {
+            vChars.flip();
+        }
+    }
+    // the next char of a class in vOutChar, or -1 if an escaped class (like \d) was added to vClass
+    bool m_ParseClassChar(std::bitset<256>& vClass, int& vOutChar) {
+        const char c = m_Regex[m_Pos++];
+        if (c == '[' && (m_Peek() == ':' || m_Peek() == '=' || m_Peek() == '.')) {  // posix classes
+            isSupported = false;
+            return false;
+        }
+        if (c != '\\') {
+            vOutChar = (uint8_t)c;
+            return true;
+        }
+        std::bitset<256> chars;
+        if (m_IsEnd() || m_Peek() == 'b' || !m_ParseEscape(chars, true)) {
+            isSupported = false;
+            return false;
+        }
+        if (chars.count() == 1U) {
+            for (int i = 0; i < 256; ++i) {
+                if (chars.test(i)) vOutChar = i;
+            }
+        } else {
+            vClass |= chars;
+            vOutChar = -1;
+        }
+        return true;
+    }
+};
+
+std::shared_ptr<IGFD::FilterMatcher> IGFD::FilterMatcher::createFromAsteriskFilter(const std::string& vFilter) {
+    if (vFilter.find_first_of("\\^$|?+()[]{}\r\n") != std::string::npos) {
+        return nullptr;  // regex chars, transformAsteriskBasedFilterToRegex keep them as is (and the line terminators, see search)
+    }
+    auto matcher_ptr                = std::make_shared<FilterMatcher>();
+    matcher_ptr->m_IsAsteriskFilter = true;
+    matcher_ptr->m_Parts            = Utils::SplitStringToVector(vFilter, '*', true);
+    return matcher_ptr;
+}
+
+std::shared_ptr<IGFD::FilterMatcher> IGFD::FilterMatcher::createFromRegex(const std::string& vRegex) {
+    auto regex_ptr   = std::make_shared<std::regex>(vRegex);  // throw if not valid, like before
+    auto matcher_ptr = std::make_shared<FilterMatcher>();
+    if (!matcher_ptr->m_BuildDfa(vRegex)) {
+        matcher_ptr->m_DfaTransitions.clear();
+        matcher_ptr->m_DfaStatesFlags.clear();
+        matcher_ptr->m_RegexPtr = regex_ptr;
+    }
+    return matcher_ptr;
+}
+
+// the asterisk filter "a*b*c" was the regex "a.*b.*c$", searched from any position :
+// so the parts are found from left to right, at the first possible position, and the last one end the text
+// the '.' don't match the line terminators (not in the parts), so only the last line of the text can match
+bool IGFD::FilterMatcher::search(const std::string& vText) const {
+    if (m_IsAsteriskFilter) {
+        const size_t last_terminator = vText.find_last_of("\r\n");
+        size_t pos                   = (last_terminator == std::string::npos) ? 0U : last_terminator + 1U;
+        for (size_t idx = 0U; idx + 1U < m_Parts.size(); ++idx) {
+            if (!m_Parts[idx].empty()) {
+                pos = vText.find(m_Parts[idx], pos);
+                if (pos == std::string::npos) {
+                    return false;
+                }
+                pos += m_Parts[idx].size();
+            }
+        }
+        const auto& last = m_Parts.empty() ? std::string() : m_Parts.back();
+        return (vText.size() >= pos + last.size() && vText.compare(vText.size() - last.size(), last.size(), last) == 0);
+    }
+    if (m_RegexPtr != nullptr) {
+        return std::regex_search(vText, *m_RegexPtr);
+    }
+    uint32_t state = 0U;
+    for (const auto& c : vText) {
+        if (m_DfaStatesFlags[state] & DfaStateFlags_AcceptNow) {
+            return true;
+        }
+        state = m_DfaTransitions[state * 256U + (uint8_t)c];
+    }
+    return (m_DfaStatesFlags[state] != 0U);  // accept now, or at the end of the text
+}
+
+// the subset construction of the nfa, with the search from any position (the nfa start is added to each dfa state)
+// a dfa state is the set of the nfa states waiting a char, the match, or waiting the end of the text ($)
+bool IGFD::FilterMatcher::m_BuildDfa(const std::string& vRegex) {
+    const RegexNfa nfa(vRegex);
+    if (!nfa.isSupported) {
+        return false;
+    }
+    const auto closure = [&nfa](std::vector<int32_t> vSeeds, bool vAtBegin, bool vAtEnd) -> std::vector<int32_t> {
+        std::vector<int32_t> states;
+        std::vector<uint8_t> visited(nfa.states.size());
+        while (!vSeeds.empty()) {
+            const auto idx = vSeeds.back();
+            vSeeds.pop_back();
+            if (idx < 0 || visited[idx]) {
+                continue;
+            }
+            visited[idx]      = 1U;
+            const auto& state = nfa.states[idx];
+            switch (state.type) {
+                case RegexNfa::StateType::Chars:
+                case RegexNfa::StateType::Match: states.push_back(idx); break;
+                case RegexNfa::StateType::Epsilon: vSeeds.push_back(state.out); break;
+                case RegexNfa::StateType::Split:
+                    vSeeds.push_back(state.out1);
+                    vSeeds.push_back(state.out);
+                    break;
+                case RegexNfa::StateType::Begin:
+                    if (vAtBegin) vSeeds.push_back(state.out);
+                    break;
+                case RegexNfa::StateType::End:
+                    if (vAtEnd) {
+                        vSeeds.push_back(state.out);
+                    } else {
+                        states.push_back(idx);
+                    }
+                    break;
+            }
+        }
+        std::sort(states.begin(), states.end());
+        return states;
+    };
+    const auto contains_match = [&nfa](const std::vector<int32_t>& vStates) -> bool {
+        for (const auto& idx : vStates) {
+            if (nfa.states[idx].type == RegexNfa::StateType::Match) return true;
+        }
+        return false;
+    };
+    std::map<std::vector<int32_t>, uint32_t> dfa_states_ids;
+    std::vector<std::vector<int32_t> > dfa_states;
+    dfa_states.push_back(closure({nfa.start}, true, false));  // the start state is only at the begin of the text, so not in dfa_states_ids
+    for (size_t dfa_idx = 0U; dfa_idx < dfa_states.size(); ++dfa_idx) {
+        const auto nfa_states = dfa_states[dfa_idx];  // copy, dfa_states can grow
+        const bool is_start   = (dfa_idx == 0U);
+        uint8_t flags         = 0U;
+        std::vector<int32_t> end_seeds;
+        for (const auto& idx : nfa_states) {
+            if (nfa.states[idx].type == RegexNfa::StateType::End) end_seeds.push_back(nfa.states[idx].out);
+        }
+        if (contains_match(nfa_states)) {
+            flags |= DfaStateFlags_AcceptNow;
+        } else if (contains_match(closure(end_seeds, is_start, true))) {
+            flags |= DfaStateFlags_AcceptAtEnd;
+        }
+        m_DfaStatesFlags.push_back(flags);
+        m_DfaTransitions.resize(m_DfaTransitions.size() + 256U, 0U);
+        if (flags & DfaStateFlags_AcceptNow) {
+            continue;  // the search end here
+        }
+        for (size_t c = 0U; c < 256U; ++c) {
+            std::vector<int32_t> seeds = {nfa.start};
+            for (const auto& idx : nfa_states) {
+                if (nfa.states[idx].type == RegexNfa::StateType::Chars && nfa.states[idx].chars.test(c)) seeds.push_back(nfa.states[idx].out);
+            }
+            auto next_states = closure(seeds, false, false);
+            auto it          = dfa_states_ids.find(next_states);
+            if (it == dfa_states_ids.end()) {
+                if (dfa_states.size() >= FILTER_REGEX_DFA_MAX_STATES) {
+                    return false;
+                }
+                it = dfa_states_ids.emplace(next_states, (uint32_t)dfa_states.size()).first;
+                dfa_states.push_back(std::move(next_states));
+            }
+            m_DfaTransitions[dfa_idx * 256U + c] = (uint16_t)it->second;
+        }
+    }
+    return true;
+}
+
+void IGFD::FilterInfos::setCollectionTitle(const std::string& vTitle) {
+    title = vTitle;
+}
+
+void IGFD::FilterInfos::addFilter(const std::string& vFilter, const bool& vIsRegex) {
+    setCollectionTitle(vFilter);
+    addCollectionFilter(vFilter, vIsRegex);
+}
+
+void IGFD::FilterInfos::addCollectionFilter(const std::string& vFilter, const bool& vIsRegex) {
     if (!vIsRegex) {
         auto _count_dots = Utils::GetCharCountInString(vFilter, '.');
         if (_count_dots > IGFD::FilterInfos::count_dots) {
@@ -1144,16 +2236,22 @@ void IGFD::FilterInfos::addCollectionFilter(const std::string& vFilter, const bo
         }
         if (vFilter.find('*') != std::string::npos) {
             const auto& regex_string = transformAsteriskBasedFilterToRegex(vFilter);
-            addCollectionFilter(regex_string, true);
+            auto matcher_ptr         = FilterMatcher::createFromAsteriskFilter(vFilter);
+            if (matcher_ptr != nullptr) {  // searched without the regex
+                filters.try_add(regex_string);
+                filters_matchers.push_back(matcher_ptr);
+            } else {
+                addCollectionFilter(regex_string, true);
+            }
             return;
         }
         filters.try_add(vFilter);
         filters_optimized.try_add(Utils::LowerCaseString(vFilter));
     } else {
         try {
-            auto rx = std::regex(vFilter);
+            auto matcher_ptr = FilterMatcher::createFromRegex(vFilter);
             filters.try_add(vFilter);
-            filters_regex.emplace_back(rx);
+            filters_matchers.push_back(matcher_ptr);
         } catch (std::exception& e) {
 			const std::string msg = "IGFD : The regex \"" + vFilter + "\" parsing was failed with msg : " + e.what();
             throw IGFDException(msg.c_str());
@@ -1165,7 +2263,7 @@ void IGFD::FilterInfos::clear() {
     title.clear();
     filters.clear();
     filters_optimized.clear();
-    filters_regex.clear();
+    filters_matchers.clear();
 }
 
 bool IGFD::FilterInfos::empty() const {
@@ -1179,18 +2277,25 @@ const std::string& IGFD::FilterInfos::getFirstFilter() const {
     return empty_string;
 }
 
+// same result as FileInfos::SearchForExt(filter, vIsCaseInsensitive, count_dots) for each filter,
+// but the ext levels of the file are searched in the hashed filters (already in lower case in filters_optimized),
+// so without allocation and whatever the count of filters
 bool IGFD::FilterInfos::exist(const FileInfos& vFileInfos, bool vIsCaseInsensitive) const {
-    for (const auto& filter : filters) {
-        if (vFileInfos.SearchForExt(filter, vIsCaseInsensitive, count_dots)) {
-            return true;
+    if (count_dots >= 1U && vFileInfos.countExtDot >= count_dots) {
+        for (size_t lvl = 0U; lvl < vFileInfos.GetCountExtLevels(); ++lvl) {
+            if (vIsCaseInsensitive ? filters_optimized.exist(vFileInfos.GetFileExtLevelOptimized(lvl)) : filters.exist(vFileInfos.GetFileExtLevel(lvl))) {
+                return true;
+            }
         }
+        return false;
     }
-    return false;
+    const char* ext = vFileInfos.GetFileExtLevel(0U);
+    return (ext[0] != '\0' && filters.exist(ext));  // an empty filter is never found
 }
 
 bool IGFD::FilterInfos::regexExist(const std::string& vFilter) const {
-    for (const auto& regex : filters_regex) {
-        if (std::regex_search(vFilter, regex)) {
+    for (const auto& matcher_ptr : filters_matchers) {
+        if (matcher_ptr->search(vFilter)) {
             return true;
         }
     }
@@ -1216,11 +2321,27 @@ std::string IGFD::FilterInfos::transformAsteriskBasedFilterToRegex(const std::st
 }
 
 const IGFD::FilterInfos& IGFD::FilterManager::GetSelectedFilter() const {
-    return m_SelectedFilter;
+    static const FilterInfos s_NoFilter;
+    if (m_SelectedFilterIndex < m_ParsedFilters.size()) {
+        return m_ParsedFilters[m_SelectedFilterIndex];
+    }
+    return s_NoFilter;
+}
+
+// the selected filter is kept by index, the filters are not copied
+void IGFD::FilterManager::m_SelectFilter(size_t vFilterIdx) {
+    if (vFilterIdx < m_ParsedFilters.size()) {
+        m_SelectedFilterIndex = vFilterIdx;
+        m_SelectedFilterTitle = m_ParsedFilters[vFilterIdx].title;
+    } else {
+        m_SelectedFilterIndex = SIZE_MAX;
+    }
 }
 
 void IGFD::FilterManager::ParseFilters(const char* vFilters) {
     m_ParsedFilters.clear();
+    m_SelectedFilterIndex = SIZE_MAX;  // the title is kept for select the same filter
+    m_MaxCountDots        = 0U;
 
     if (vFilters) {
         dLGFilters = vFilters;  // file mode
@@ -1229,263 +2350,502 @@ void IGFD::FilterManager::ParseFilters(const char* vFilters) {
     }
 
     if (!dLGFilters.empty()) {
-        /* Rules
-        0) a filter must have 2 chars mini and the first must be a .
-        1) a regex must be in (( and ))
-        2) a , will separate filters except if between a ( and )
-        3) name{filter1, filter2} is a spetial form for collection filters
-        3.1) the name can be composed of what you want except { and }
-        3.2) the filter can be a regex
-        4) the filters cannot integrate these chars '(' ')' '{' '}' ' ' except for a regex with respect to rule 1)
-        5) the filters cannot integrate a ','
-        */
+        if (!M_GetCachedParsedFilters(dLGFilters, m_ParsedFilters)) {
+            m_ParseFiltersString(dLGFilters);
+            M_CacheParsedFilters(dLGFilters, m_ParsedFilters);
+        }
+
+        for (const auto& it : m_ParsedFilters) {
+            m_MaxCountDots = (std::max)(m_MaxCountDots, it.count_dots);
+        }
 
         bool current_filter_found = false;
-        bool started              = false;
-        bool regex_started        = false;
-        bool parenthesis_started  = false;
+        for (size_t idx = 0U; idx < m_ParsedFilters.size(); ++idx) {
+            if (m_ParsedFilters[idx].title == m_SelectedFilterTitle) {
+                m_SelectFilter(idx);
+                current_filter_found = true;
+                break;
+            }
+        }
+
+        if (!current_filter_found) {
+            if (!m_ParsedFilters.empty()) {
+                m_SelectFilter(0U);
+            }
+        }
+    }
+}
 
-        std::string word;
-        std::string filter_name;
+// the parsed filters are shared by the dialogs of the process, by filters string,
+// so a dialog opened again with the same filters get them without parsing them and compiling the regexs
+// (the FilterMatcher's are shared by the copies of the FilterInfos)
+static std::mutex s_ParsedFiltersCacheMutex;
+static std::unordered_map<std::string, std::vector<IGFD::FilterInfos> > s_ParsedFiltersCache;
 
-        char last_split_char = 0;
-        for (char c : dLGFilters) {
-            if (c == '{') {
-                if (regex_started) {
-                    word += c;
-                } else {
-                    started = true;
-                    m_ParsedFilters.emplace_back();
-                    m_ParsedFilters.back().setCollectionTitle(filter_name);
-                    filter_name.clear();
-                    word.clear();
-                }
-                last_split_char = c;
-            } else if (c == '}') {
-                if (regex_started) {
-                    word += c;
-                } else {
-                    if (started) {
-                        if (word.size() > 1U && word[0] == '.') {
-                            if (m_ParsedFilters.empty()) {
-                                m_ParsedFilters.emplace_back();
-                            }
-                            m_ParsedFilters.back().addCollectionFilter(word, false);
-                        }
-                        word.clear();
-                        filter_name.clear();
-                        started = false;
-                    }
-                }
-                last_split_char = c;
-            } else if (c == '(') {
+bool IGFD::FilterManager::M_GetCachedParsedFilters(const std::string& vFilters, std::vector<FilterInfos>& vOutParsedFilters) {
+    std::lock_guard<std::mutex> lock(s_ParsedFiltersCacheMutex);
+    const auto it = s_ParsedFiltersCache.find(vFilters);
+    if (it == s_ParsedFiltersCache.end()) {
+        return false;
+    }
+    vOutParsedFilters = it->second;
+    return true;
+}
+
+void IGFD::FilterManager::M_CacheParsedFilters(const std::string& vFilters, const std::vector<FilterInfos>& vParsedFilters) {
+    std::lock_guard<std::mutex> lock(s_ParsedFiltersCacheMutex);
+    if (s_ParsedFiltersCache.size() >= PARSED_FILTERS_CACHE_MAX_COUNT) {
+        s_ParsedFiltersCache.clear();
+    }
+    s_ParsedFiltersCache[vFilters] = vParsedFilters;
+}
+
+void IGFD::FilterManager::m_ParseFiltersString(const std::string& vFilters) {
+    /* Rules
+    0) a filter must have 2 chars mini and the first must be a .
+    1) a regex must be in (( and ))
+    2) a , will separate filters except if between a ( and )
+    3) name{filter1, filter2} is a spetial form for collection filters
+    3.1) the name can be composed of what you want except { and }
+    3.2) the filter can be a regex
+    4) the filters cannot integrate these chars '(' ')' '{' '}' ' ' except for a regex with respect to rule 1)
+    5) the filters cannot integrate a ','
+    */
+
+    bool started             = false;
+    bool regex_started       = false;
+    bool parenthesis_started = false;
+
+    std::string word;
+    std::string filter_name;
+
+    char last_split_char = 0;
+    for (char c : vFilters) {
+        if (c == '{') {
+            if (regex_started) {
                 word += c;
-                if (last_split_char == '(') {
-                    regex_started = true;
-                }
-                parenthesis_started = true;
-                if (!started) {
-                    filter_name += c;
-                }
-                last_split_char = c;
-            } else if (c == ')') {
+            } else {
+                started = true;
+                m_ParsedFilters.emplace_back();
+                m_ParsedFilters.back().setCollectionTitle(filter_name);
+                filter_name.clear();
+                word.clear();
+            }
+            last_split_char = c;
+        } else if (c == '}') {
+            if (regex_started) {
                 word += c;
-                if (last_split_char == ')') {
-                    if (regex_started) {
-                        if (started) {
-                            m_ParsedFilters.back().addCollectionFilter(word, true);
-                        } else {
+            } else {
+                if (started) {
+                    if (word.size() > 1U && word[0] == '.') {
+                        if (m_ParsedFilters.empty()) {
                             m_ParsedFilters.emplace_back();
-                            m_ParsedFilters.back().addFilter(word, true);
-                        }
-                        word.clear();
-                        filter_name.clear();
-                        regex_started = false;
-                    } else {
-                        if (!started) {
-                            if (!m_ParsedFilters.empty()) {
-                                m_ParsedFilters.erase(m_ParsedFilters.begin() + m_ParsedFilters.size() - 1U);
-                            } else {
-                                m_ParsedFilters.clear();
-                            }
                         }
-                        word.clear();
-                        filter_name.clear();
+                        m_ParsedFilters.back().addCollectionFilter(word, false);
                     }
+                    word.clear();
+                    filter_name.clear();
+                    started = false;
                 }
-                parenthesis_started = false;
-                if (!started) {
-                    filter_name += c;
-                }
-                last_split_char = c;
-            } else if (c == '.') {
-                word += c;
-                if (!started) {
-                    filter_name += c;
-                }
-                last_split_char = c;
-            } else if (c == ',') {
+            }
+            last_split_char = c;
+        } else if (c == '(') {
+            word += c;
+            if (last_split_char == '(') {
+                regex_started = true;
+            }
+            parenthesis_started = true;
+            if (!started) {
+                filter_name += c;
+            }
+            last_split_char = c;
+        } else if (c == ')') {
+            word += c;
+            if (last_split_char == ')') {
                 if (regex_started) {
-                    regex_started = false;
+                    if (started) {
+                        m_ParsedFilters.back().addCollectionFilter(word, true);
+                    } else {
+                        m_ParsedFilters.emplace_back();
+                        m_ParsedFilters.back().addFilter(word, true);
+                    }
                     word.clear();
                     filter_name.clear();
+                    regex_started = false;
                 } else {
-                    if (started) {
-                        if (word.size() > 1U && word[0] == '.') {
-                            m_ParsedFilters.back().addCollectionFilter(word, false);
-                            word.clear();
-                            filter_name.clear();
-                        }
-                    } else {
-                        if (word.size() > 1U && word[0] == '.') {
-                            m_ParsedFilters.emplace_back();
-                            m_ParsedFilters.back().addFilter(word, false);
-                            word.clear();
-                            filter_name.clear();
-                        }
-                        if (parenthesis_started) {
-                            filter_name += c;
+                    if (!started) {
+                        if (!m_ParsedFilters.empty()) {
+                            m_ParsedFilters.erase(m_ParsedFilters.begin() + m_ParsedFilters.size() - 1U);
+                        } else {
+                            m_ParsedFilters.clear();
                         }
                     }
+                    word.clear();
+                    filter_name.clear();
                 }
+            }
+            parenthesis_started = false;
+            if (!started) {
+                filter_name += c;
+            }
+            last_split_char = c;
+        } else if (c == '.') {
+            word += c;
+            if (!started) {
+                filter_name += c;
+            }
+            last_split_char = c;
+        } else if (c == ',') {
+            if (regex_started) {
+                regex_started = false;
+                word.clear();
+                filter_name.clear();
             } else {
-                if (c != ' ') {
-                    word += c;
-                }
-                if (!started) {
-                    filter_name += c;
+                if (started) {
+                    if (word.size() > 1U && word[0] == '.') {
+                        m_ParsedFilters.back().addCollectionFilter(word, false);
+                        word.clear();
+                        filter_name.clear();
+                    }
+                } else {
+                    if (word.size() > 1U && word[0] == '.') {
+                        m_ParsedFilters.emplace_back();
+                        m_ParsedFilters.back().addFilter(word, false);
+                        word.clear();
+                        filter_name.clear();
+                    }
+                    if (parenthesis_started) {
+                        filter_name += c;
+                    }
                 }
             }
-        }
-
-        if (started) {
-            if (!m_ParsedFilters.empty()) {
-                m_ParsedFilters.erase(m_ParsedFilters.begin() + m_ParsedFilters.size() - 1U);
-            } else {
-                m_ParsedFilters.clear();
+        } else {
+            if (c != ' ') {
+                word += c;
             }
-        } else if (word.size() > 1U && word[0] == '.') {
-            m_ParsedFilters.emplace_back();
-            m_ParsedFilters.back().addFilter(word, false);
-            word.clear();
-        }
-
-        for (const auto& it : m_ParsedFilters) {
-            if (it.title == m_SelectedFilter.title) {
-                m_SelectedFilter     = it;
-                current_filter_found = true;
-                break;
+            if (!started) {
+                filter_name += c;
             }
         }
+    }
 
-        if (!current_filter_found) {
-            if (!m_ParsedFilters.empty()) {
-                m_SelectedFilter = *m_ParsedFilters.begin();
-            }
+    if (started) {
+        if (!m_ParsedFilters.empty()) {
+            m_ParsedFilters.erase(m_ParsedFilters.begin() + m_ParsedFilters.size() - 1U);
+        } else {
+            m_ParsedFilters.clear();
         }
+    } else if (word.size() > 1U && word[0] == '.') {
+        m_ParsedFilters.emplace_back();
+        m_ParsedFilters.back().addFilter(word, false);
+        word.clear();
     }
 }
 
 void IGFD::FilterManager::SetSelectedFilterWithExt(const std::string& vFilter) {
     if (!m_ParsedFilters.empty()) {
         if (!vFilter.empty()) {
-            for (const auto& infos : m_ParsedFilters) {
-                for (const auto& filter : infos.filters) {
+            for (size_t idx = 0U; idx < m_ParsedFilters.size(); ++idx) {
+                for (const auto& filter : m_ParsedFilters[idx].filters) {
                     if (vFilter == filter) {
-                        m_SelectedFilter = infos;
+                        m_SelectFilter(idx);
                     }
                 }
             }
         }
 
-        if (m_SelectedFilter.empty()) {
-            m_SelectedFilter = *m_ParsedFilters.begin();
+        if (GetSelectedFilter().empty()) {
+            m_SelectFilter(0U);
         }
     }
 }
 
 void IGFD::FilterManager::SetFileStyle(const IGFD_FileStyleFlags& vFlags, const char* vCriteria, const FileStyle& vInfos) {
-    std::string _criteria                  = (vCriteria != nullptr) ? std::string(vCriteria) : "";
-    m_FilesStyle[vFlags][_criteria]        = std::make_shared<FileStyle>(vInfos);
-    m_FilesStyle[vFlags][_criteria]->flags = vFlags;
+    std::string _criteria = (vCriteria != nullptr) ? std::string(vCriteria) : "";
+    auto style_ptr        = std::make_shared<FileStyle>(vInfos);
+    style_ptr->flags      = vFlags;
+    m_AddFileStyleRule(vFlags, _criteria, style_ptr);
+}
+
+// the regex is compiled here one time, instead of for each file, and before any change, so a bad regex let the styles as they was
+// a rule set again keep his place in the declaration order
+// the lookups are built again by the next FillFileStyle or FillFilesStyle, so N styles set in a row cost one build, not N
+void IGFD::FilterManager::m_AddFileStyleRule(const IGFD_FileStyleFlags& vFlags, const std::string& vCriteria, const std::shared_ptr<FileStyle>& vStyle) {
+    const auto styles_it = m_FilesStyle.find(vFlags);
+    if (styles_it != m_FilesStyle.end() && styles_it->second.find(vCriteria) != styles_it->second.end()) {  // the criteria was already validated
+        for (auto& rule : m_FileStyleRules) {
+            if (rule.flags == vFlags && rule.criteria == vCriteria) {
+                m_FilesStyle[vFlags][vCriteria] = vStyle;
+                rule.style                      = vStyle;  // the lookups give rule indexes, so they are still good
+                return;
+            }
+        }
+    }
+    FileStyleRule rule;
+    rule.flags    = vFlags;
+    rule.criteria = vCriteria;
+    rule.style    = vStyle;
+    if (vCriteria.find("((") != std::string::npos) {
+        try {
+            rule.regexPtr = std::make_shared<std::regex>(vCriteria);
+        } catch (std::exception& e) {
+            const std::string msg = "IGFD : The regex \"" + vCriteria + "\" parsing was failed with msg : " + e.what();
+            throw IGFDException(msg.c_str());
+        }
+    }
+    m_FilesStyle[vFlags][vCriteria] = vStyle;
+    m_FileStyleRules.push_back(rule);
+    m_FilesStyleIsDirty = true;
 }
 
-// will be called internally
-// will not been exposed to IGFD API
-bool IGFD::FilterManager::FillFileStyle(std::shared_ptr<FileInfos> vFileInfos) const {
-    // todo : better system to found regarding what style to priorize regarding other
-    // maybe with a lambda fucntion for let the user use his style
-    // according to his use case
-    if (vFileInfos.use_count() && !m_FilesStyle.empty()) {
-        for (const auto& _flag : m_FilesStyle) {
-            for (const auto& _file : _flag.second) {
-                if ((_flag.first & IGFD_FileStyleByTypeDir && _flag.first & IGFD_FileStyleByTypeLink && vFileInfos->fileType.isDir() && vFileInfos->fileType.isSymLink()) ||
-                    (_flag.first & IGFD_FileStyleByTypeFile && _flag.first & IGFD_FileStyleByTypeLink && vFileInfos->fileType.isFile() && vFileInfos->fileType.isSymLink()) ||
-                    (_flag.first & IGFD_FileStyleByTypeLink && vFileInfos->fileType.isSymLink()) || (_flag.first & IGFD_FileStyleByTypeDir && vFileInfos->fileType.isDir()) ||
-                    (_flag.first & IGFD_FileStyleByTypeFile && vFileInfos->fileType.isFile())) {
-                    if (_file.first.empty()) {  // for all links
-                        vFileInfos->fileStyle = _file.second;
-                    } else if (_file.first.find("((") != std::string::npos && std::regex_search(vFileInfos->fileNameExt,
-                                                                                                std::regex(_file.first))) {  // for links who are equal to style criteria
-                        vFileInfos->fileStyle = _file.second;
-                    } else if (_file.first == vFileInfos->fileNameExt) {  // for links who are equal to style criteria
-                        vFileInfos->fileStyle = _file.second;
-                    }
-                }
-
-                if (_flag.first & IGFD_FileStyleByExtention) {
-                    if (_file.first.find("((") != std::string::npos && std::regex_search(vFileInfos->fileExtLevels[0], std::regex(_file.first))) {
-                        vFileInfos->fileStyle = _file.second;
-                    } else if (vFileInfos->SearchForExt(_file.first, false)) {
-                        vFileInfos->fileStyle = _file.second;
-                    }
-                }
+// called by the const FillFileStyle and FillFilesStyle, before any worker thread, so the lookups are mutable
+// an async scan work on its own copy of the FilterManager, who is compiled by the scan thread if needed
+void IGFD::FilterManager::m_CompileFilesStyleIfNeeded() const {
+    if (m_FilesStyleIsDirty) {
+        m_CompileFilesStyle();
+        m_FilesStyleIsDirty = false;
+    }
+}
 
-                if (_flag.first & IGFD_FileStyleByFullName) {
-                    if (_file.first.find("((") != std::string::npos && std::regex_search(vFileInfos->fileNameExt, std::regex(_file.first))) {
-                        vFileInfos->fileStyle = _file.second;
-                    } else if (_file.first == vFileInfos->fileNameExt) {
-                        vFileInfos->fileStyle = _file.second;
+void IGFD::FilterManager::m_CompileFilesStyle() const {
+    m_FileStyleRuleIndexesByName.clear();
+    m_FileStyleRuleIndexesByExt.clear();
+    m_FileStyleRegexRuleIndexes.clear();
+    m_FileStyleTypeRuleIndexes.clear();
+    m_FileStyleContainedNodes.clear();
+    m_FileStyleContainedNodes.emplace_back();  // root
+    const IGFD_FileStyleFlags type_flags = IGFD_FileStyleByTypeFile | IGFD_FileStyleByTypeDir | IGFD_FileStyleByTypeLink;
+    for (size_t rule_idx = 0U; rule_idx < m_FileStyleRules.size(); ++rule_idx) {
+        const auto& rule = m_FileStyleRules[rule_idx];
+        if (rule.regexPtr != nullptr) {
+            m_FileStyleRegexRuleIndexes.push_back(rule_idx);
+        }
+        if ((rule.flags & type_flags) && rule.criteria.empty()) {
+            m_FileStyleTypeRuleIndexes.push_back(rule_idx);
+        }
+        if ((rule.flags & (type_flags | IGFD_FileStyleByFullName)) && !rule.criteria.empty()) {
+            m_FileStyleRuleIndexesByName[rule.criteria].push_back(rule_idx);
+        }
+        if ((rule.flags & IGFD_FileStyleByExtention) && !rule.criteria.empty()) {
+            m_FileStyleRuleIndexesByExt[rule.criteria].push_back(rule_idx);
+        }
+        if (rule.flags & IGFD_FileStyleByContainedInFullName) {  // an empty criteria is contained in all names, so end at the root
+            uint32_t node_idx = 0U;
+            for (const auto& c : rule.criteria) {
+                uint32_t child_idx = 0U;
+                for (const auto& child : m_FileStyleContainedNodes[node_idx].children) {
+                    if (child.first == c) {
+                        child_idx = child.second;
+                        break;
                     }
                 }
-
-                if (_flag.first & IGFD_FileStyleByContainedInFullName) {
-                    if (_file.first.find("((") != std::string::npos && std::regex_search(vFileInfos->fileNameExt, std::regex(_file.first))) {
-                        vFileInfos->fileStyle = _file.second;
-                    } else if (vFileInfos->fileNameExt.find(_file.first) != std::string::npos) {
-                        vFileInfos->fileStyle = _file.second;
-                    }
+                if (child_idx == 0U) {
+                    child_idx = (uint32_t)m_FileStyleContainedNodes.size();
+                    m_FileStyleContainedNodes[node_idx].children.emplace_back(c, child_idx);
+                    m_FileStyleContainedNodes.emplace_back();
                 }
-
-                for (auto& functor : m_FilesStyleFunctors) {
-                    if (functor) {
-                        FileStyle result;
-                        if (functor(*(vFileInfos.get()), result)) {
-                            vFileInfos->fileStyle = std::make_shared<FileStyle>(std::move(result));
-                        }
+                node_idx = child_idx;
+            }
+            m_FileStyleContainedNodes[node_idx].ruleIndexes.push_back(rule_idx);
+        }
+    }
+    // the failure nodes, by a breadth first walk, so the failure node of a parent is always done before
+    std::vector<uint32_t> queue;
+    for (const auto& child : m_FileStyleContainedNodes[0U].children) {
+        queue.push_back(child.second);
+    }
+    for (size_t queue_idx = 0U; queue_idx < queue.size(); ++queue_idx) {
+        const auto node_idx = queue[queue_idx];
+        for (const auto& child : m_FileStyleContainedNodes[node_idx].children) {
+            uint32_t failure_idx = m_FileStyleContainedNodes[node_idx].failure;
+            uint32_t next_idx    = 0U;
+            while (true) {
+                for (const auto& failure_child : m_FileStyleContainedNodes[failure_idx].children) {
+                    if (failure_child.first == child.first) {
+                        next_idx = failure_child.second;
+                        break;
                     }
                 }
-
-                if (vFileInfos->fileStyle.use_count()) {
-                    return true;
-                }
+                if (next_idx != 0U || failure_idx == 0U) break;
+                failure_idx = m_FileStyleContainedNodes[failure_idx].failure;
             }
+            auto& child_node   = m_FileStyleContainedNodes[child.second];
+            child_node.failure = next_idx;
+            const auto& failure_rules = m_FileStyleContainedNodes[next_idx].ruleIndexes;
+            child_node.ruleIndexes.insert(child_node.ruleIndexes.end(), failure_rules.begin(), failure_rules.end());
+            queue.push_back(child.second);
         }
     }
-
-    return false;
 }
 
-void IGFD::FilterManager::SetFileStyle(const IGFD_FileStyleFlags& vFlags, const char* vCriteria, const ImVec4& vColor, const std::string& vIcon, ImFont* vFont) {
-    std::string _criteria;
-    if (vCriteria) _criteria = std::string(vCriteria);
-    m_FilesStyle[vFlags][_criteria]        = std::make_shared<FileStyle>(vColor, vIcon, vFont);
-    m_FilesStyle[vFlags][_criteria]->flags = vFlags;
+// will be called internally
+// will not been exposed to IGFD API
+// the functors are called from the calling thread, once per file, after the rules
+bool IGFD::FilterManager::FillFileStyle(std::shared_ptr<FileInfos> vFileInfos) const {
+    if (!vFileInfos.use_count()) {
+        return false;
+    }
+    m_CompileFilesStyleIfNeeded();
+    m_FillFileStyleByRules(*vFileInfos);
+    const std::vector<std::shared_ptr<FileInfos> > files = {vFileInfos};
+    for (const auto& functor_infos : m_FilesStyleFunctors) {
+        M_CallFileStyleFunctor(functor_infos, files, 0U, 1U);
+    }
+    return (vFileInfos->fileStyle.use_count() != 0);
+}
+
+// will be called internally
+// will not been exposed to IGFD API
+// the style classification stage of a scan : the rules, then each functor in the declaration order (so the last one defining a style win),
+// called once per file, by many threads if thread safe, else from the calling thread
+void IGFD::FilterManager::FillFilesStyle(const std::vector<std::shared_ptr<FileInfos> >& vFiles, size_t vThreadsCount) const {
+    m_CompileFilesStyleIfNeeded();  // before the workers
+    Utils::ParallelFor(vFiles.size(), vThreadsCount, PARALLEL_SCAN_MIN_CHUNK_SIZE, [this, &vFiles](size_t vStart, size_t vEnd) {
+        for (size_t idx = vStart; idx < vEnd; ++idx) {
+            m_FillFileStyleByRules(*vFiles[idx]);
+        }
+    });
+    for (const auto& functor_infos : m_FilesStyleFunctors) {
+        Utils::ParallelFor(vFiles.size(), functor_infos.isThreadSafe ? vThreadsCount : 1U, PARALLEL_SCAN_MIN_CHUNK_SIZE,
+                           [&functor_infos, &vFiles](size_t vStart, size_t vEnd) {  //
+                               M_CallFileStyleFunctor(functor_infos, vFiles, vStart, vEnd);
+                           });
+    }
+}
+
+// a batch functor is called once for the files between vStart and vEnd, and give his styles without copy
+void IGFD::FilterManager::M_CallFileStyleFunctor(const FileStyleFunctorInfos& vFunctorInfos, const std::vector<std::shared_ptr<FileInfos> >& vFiles, size_t vStart, size_t vEnd) {
+    if (vFunctorInfos.functor) {
+        for (size_t idx = vStart; idx < vEnd; ++idx) {
+            FileStyle result;
+            if (vFunctorInfos.functor(*vFiles[idx], result)) {
+                vFiles[idx]->fileStyle = std::make_shared<FileStyle>(std::move(result));
+            }
+        }
+    } else if (vFunctorInfos.batchFunctor) {
+        std::vector<const FileInfos*> files;
+        files.reserve(vEnd - vStart);
+        for (size_t idx = vStart; idx < vEnd; ++idx) {
+            files.push_back(vFiles[idx].get());
+        }
+        std::vector<std::shared_ptr<FileStyle> > styles(files.size());
+        vFunctorInfos.batchFunctor(files, styles);
+        for (size_t idx = 0U; idx < files.size() && idx < styles.size(); ++idx) {
+            if (styles[idx] != nullptr) {
+                vFiles[vStart + idx]->fileStyle = styles[idx];
+            }
+        }
+    }
+}
+
+// the rules are searched in one pass, by the lookups of m_CompileFilesStyle, and the most specific rule found is applied :
+// 1) by full name, or by type with a criteria, 2) by extention, 3) contained in full name,
+// 4) by type only, the rules matching the most types first (a dir link before the dirs or the links)
+// between rules of the same kind, the first declared is applied
+void IGFD::FilterManager::m_FillFileStyleByRules(FileInfos& vFileInfos) const {
+    const auto& infos    = vFileInfos;
+    const auto type_bits = [&infos](IGFD_FileStyleFlags vFlags) -> size_t {  // count of the types of the rule matching the file
+        return (size_t)((vFlags & IGFD_FileStyleByTypeFile) && infos.fileType.isFile()) + (size_t)((vFlags & IGFD_FileStyleByTypeDir) && infos.fileType.isDir()) +
+               (size_t)((vFlags & IGFD_FileStyleByTypeLink) && infos.fileType.isSymLink());
+    };
+    const size_t count = m_FileStyleRules.size();
+    size_t best_rank   = SIZE_MAX;  // priority * count + rule index, the lower is applied
+    const auto apply   = [&](size_t vPriority, size_t vRuleIdx) {
+        best_rank = (std::min)(best_rank, vPriority * count + vRuleIdx);
+    };
+    if (count != 0U) {
+        const auto by_name = m_FileStyleRuleIndexesByName.find(infos.fileNameExt);
+        if (by_name != m_FileStyleRuleIndexesByName.end()) {
+            for (const auto& rule_idx : by_name->second) {
+                const auto& flags = m_FileStyleRules[rule_idx].flags;
+                if ((flags & IGFD_FileStyleByFullName) || type_bits(flags) != 0U) {
+                    apply(0U, rule_idx);
+                }
+            }
+        }
+        for (const auto& rule_idx : m_FileStyleRegexRuleIndexes) {
+            const auto& rule = m_FileStyleRules[rule_idx];
+            if (((rule.flags & IGFD_FileStyleByFullName) || type_bits(rule.flags) != 0U) && std::regex_search(infos.fileNameExt, *rule.regexPtr)) {
+                apply(0U, rule_idx);
+            }
+            if ((rule.flags & IGFD_FileStyleByExtention) && std::regex_search(infos.GetFileExtLevel(0U), *rule.regexPtr)) {
+                apply(1U, rule_idx);
+            }
+            if ((rule.flags & IGFD_FileStyleByContainedInFullName) && std::regex_search(infos.fileNameExt, *rule.regexPtr)) {
+                apply(2U, rule_idx);
+            }
+        }
+        if (!m_FileStyleRuleIndexesByExt.empty()) {  // like FileInfos::SearchForExt(criteria, false)
+            const size_t count_levels = (EXT_MAX_LEVEL >= 1U && infos.countExtDot >= EXT_MAX_LEVEL) ? infos.GetCountExtLevels() : 1U;
+            for (size_t lvl = 0U; lvl < count_levels; ++lvl) {
+                const auto by_ext = m_FileStyleRuleIndexesByExt.find(infos.GetFileExtLevel(lvl));
+                if (by_ext != m_FileStyleRuleIndexesByExt.end()) {
+                    for (const auto& rule_idx : by_ext->second) {
+                        apply(1U, rule_idx);
+                    }
+                }
+            }
+        }
+        if (m_FileStyleContainedNodes.size() > 1U || !m_FileStyleContainedNodes[0U].ruleIndexes.empty()) {
+            uint32_t node_idx = 0U;
+            for (const auto& rule_idx : m_FileStyleContainedNodes[0U].ruleIndexes) {
+                apply(2U, rule_idx);
+            }
+            for (const auto& c : infos.fileNameExt) {
+                while (true) {
+                    uint32_t next_idx = 0U;
+                    for (const auto& child : m_FileStyleContainedNodes[node_idx].children) {
+                        if (child.first == c) {
+                            next_idx = child.second;
+                            break;
+                        }
+                    }
+                    if (next_idx != 0U || node_idx == 0U) {
+                        node_idx = next_idx;
+                        break;
+                    }
+                    node_idx = m_FileStyleContainedNodes[node_idx].failure;
+                }
+                for (const auto& rule_idx : m_FileStyleContainedNodes[node_idx].ruleIndexes) {
+                    apply(2U, rule_idx);
+                }
+            }
+        }
+        for (const auto& rule_idx : m_FileStyleTypeRuleIndexes) {
+            const auto bits = type_bits(m_FileStyleRules[rule_idx].flags);
+            if (bits != 0U) {
+                apply(6U - bits, rule_idx);  // 3 to 5
+            }
+        }
+        if (best_rank != SIZE_MAX) {
+            vFileInfos.fileStyle = m_FileStyleRules[best_rank % count].style;
+        }
+    }
 }
 
-void IGFD::FilterManager::SetFileStyle(FileStyle::FileStyleFunctor vFunctor) {
+void IGFD::FilterManager::SetFileStyle(const IGFD_FileStyleFlags& vFlags, const char* vCriteria, const ImVec4& vColor, const std::string& vIcon, ImFont* vFont) {
+    std::string _criteria;
+    if (vCriteria) _criteria = std::string(vCriteria);
+    auto style_ptr   = std::make_shared<FileStyle>(vColor, vIcon, vFont);
+    style_ptr->flags = vFlags;
+    m_AddFileStyleRule(vFlags, _criteria, style_ptr);
+}
+
+void IGFD::FilterManager::SetFileStyle(FileStyle::FileStyleFunctor vFunctor, bool vIsThreadSafe) {
+    if (vFunctor) {
+        FileStyleFunctorInfos functor_infos;
+        functor_infos.functor      = vFunctor;
+        functor_infos.isThreadSafe = vIsThreadSafe;
+        m_FilesStyleFunctors.push_back(functor_infos);
+    }
+}
+
+void IGFD::FilterManager::SetFileStyleBatch(FileStyle::FileStyleBatchFunctor vFunctor, bool vIsThreadSafe) {
     if (vFunctor) {
-        m_FilesStyleFunctors.push_back(vFunctor);
+        FileStyleFunctorInfos functor_infos;
+        functor_infos.batchFunctor = vFunctor;
+        functor_infos.isThreadSafe = vIsThreadSafe;
+        m_FilesStyleFunctors.push_back(functor_infos);
     }
 }
 
@@ -1548,19 +2908,65 @@ bool IGFD::FilterManager::GetFileStyle(const IGFD_FileStyleFlags& vFlags, const
 
 void IGFD::FilterManager::ClearFilesStyle() {
     m_FilesStyle.clear();
+    m_FileStyleRules.clear();
+    m_FilesStyleIsDirty = true;
 }
 
 bool IGFD::FilterManager::IsCoveredByFilters(const FileInfos& vFileInfos, bool vIsCaseInsensitive) const {
-    if (!dLGFilters.empty() && !m_SelectedFilter.empty()) {
-        return (m_SelectedFilter.exist(vFileInfos, vIsCaseInsensitive) || m_SelectedFilter.regexExist(vFileInfos.fileNameExt));
+    const auto& selected_filter = GetSelectedFilter();
+    if (!dLGFilters.empty() && !selected_filter.empty()) {
+        return (selected_filter.exist(vFileInfos, vIsCaseInsensitive) || selected_filter.regexExist(vFileInfos.fileNameExt));
     }
 
     return false;
 }
 
+// the bit of a filter in FileInfos::filtersMask, the filters from the 64th share the last bit
+static uint64_t getFilterMaskBit(size_t vFilterIdx) {
+    return (uint64_t)1U << (std::min)(vFilterIdx, (size_t)63U);
+}
+
+// a file is classified once against all the filters, then another selected filter is only another bit to test.
+// a filter string of n dots can only be the ext level of the n'th dot from the end, so the levels parsed with the max count_dots
+// give the same result for all the filters. except above EXT_MAX_LEVEL, where the last levels are not kept, so each filter parse his levels
+uint64_t IGFD::FilterManager::GetCoveringFiltersMask(FileInfos& vFileInfos, bool vIsCaseInsensitive) const {
+    uint64_t mask = 0U;
+    if (!dLGFilters.empty()) {
+        size_t parsed_dots = SIZE_MAX;
+        for (size_t idx = 0U; idx < m_ParsedFilters.size(); ++idx) {
+            const auto bit = getFilterMaskBit(idx);
+            if ((mask & bit) != 0U) continue;  // a filter after the 63th, and the last bit is already set
+            const auto& filter = m_ParsedFilters[idx];
+            const auto dots    = (m_MaxCountDots > EXT_MAX_LEVEL) ? filter.count_dots : m_MaxCountDots;
+            if (dots != parsed_dots) {
+                vFileInfos.FinalizeFileTypeParsing(dots);
+                parsed_dots = dots;
+            }
+            if (!filter.empty() && (filter.exist(vFileInfos, vIsCaseInsensitive) || filter.regexExist(vFileInfos.fileNameExt))) {
+                mask |= bit;
+            }
+        }
+    }
+    return mask;
+}
+
+bool IGFD::FilterManager::IsCoveredBySelectedFilter(const FileInfos& vFileInfos, bool vIsCaseInsensitive) const {
+    if (!vFileInfos.fileType.isFile() && !vFileInfos.fileType.isLinkToUnknown()) {
+        return true;  // like FileInfos::FinalizeFileTypeParsing, the dirs have no ext levels, and are not filtered
+    }
+    const auto bit = getFilterMaskBit(m_SelectedFilterIndex);
+    if ((vFileInfos.filtersMask & bit) == 0U) {
+        return false;
+    }
+    if (m_SelectedFilterIndex >= 63U) {  // the last bit is shared, so the filter is checked with the ext levels of the selected filter
+        return IsCoveredByFilters(vFileInfos, vIsCaseInsensitive);
+    }
+    return true;
+}
+
 float IGFD::FilterManager::GetFilterComboBoxWidth() const {
 #if FILTER_COMBO_AUTO_SIZE
-    const auto& combo_width = ImGui::CalcTextSize(m_SelectedFilter.title.c_str()).x + ImGui::GetFrameHeight() + ImGui::GetStyle().ItemInnerSpacing.x;
+    const auto& combo_width = ImGui::CalcTextSize(GetSelectedFilter().title.c_str()).x + ImGui::GetFrameHeight() + ImGui::GetStyle().ItemInnerSpacing.x;
     return ImMax(combo_width, FILTER_COMBO_MIN_WIDTH);
 #else
     return FILTER_COMBO_MIN_WIDTH;
@@ -1572,13 +2978,22 @@ bool IGFD::FilterManager::DrawFilterComboBox(FileDialogInternal& vFileDialogInte
         ImGui::SameLine();
         bool needToApllyNewFilter = false;
         ImGui::PushItemWidth(GetFilterComboBoxWidth());
-        if (IMGUI_BEGIN_COMBO("##Filters", m_SelectedFilter.title.c_str(), ImGuiComboFlags_None)) {
-            intptr_t i = 0;
-            for (const auto& filter : m_ParsedFilters) {
-                const bool item_selected = (filter.title == m_SelectedFilter.title);
-                ImGui::PushID((void*)(intptr_t)i++);
-                if (ImGui::Selectable(filter.title.c_str(), item_selected)) {
-                    m_SelectedFilter     = filter;
+        if (IMGUI_BEGIN_COMBO("##Filters", GetSelectedFilter().title.c_str(), ImGuiComboFlags_None)) {
+#if FILTER_COMBO_SHOW_FILES_COUNT
+            const auto& files_counts = vFileDialogInternal.fileManager.GetFilesCountByFilter(vFileDialogInternal);
+#endif  // FILTER_COMBO_SHOW_FILES_COUNT
+            for (size_t idx = 0U; idx < m_ParsedFilters.size(); ++idx) {
+                const auto& filter       = m_ParsedFilters[idx];
+                const bool item_selected = (idx == m_SelectedFilterIndex);
+                ImGui::PushID((void*)(intptr_t)idx);
+#if FILTER_COMBO_SHOW_FILES_COUNT
+                // the count change during an async scan, so the id of the item is only his title
+                const auto& label = (idx < 63U && idx < files_counts.size()) ? filter.title + " (" + std::to_string(files_counts[idx]) + ")###" + filter.title : filter.title;
+#else
+                const auto& label = filter.title;
+#endif  // FILTER_COMBO_SHOW_FILES_COUNT
+                if (ImGui::Selectable(label.c_str(), item_selected)) {
+                    m_SelectFilter(idx);
                     needToApllyNewFilter = true;
                 }
                 ImGui::PopID();
@@ -1587,7 +3002,7 @@ bool IGFD::FilterManager::DrawFilterComboBox(FileDialogInternal& vFileDialogInte
         }
         ImGui::PopItemWidth();
         if (needToApllyNewFilter) {
-            vFileDialogInternal.fileManager.OpenCurrentPath(vFileDialogInternal);
+            vFileDialogInternal.fileManager.ApplySelectedFilter(vFileDialogInternal);
         }
         return needToApllyNewFilter;
     }
@@ -1597,7 +3012,7 @@ bool IGFD::FilterManager::DrawFilterComboBox(FileDialogInternal& vFileDialogInte
 std::string IGFD::FilterManager::ReplaceExtentionWithCurrentFilterIfNeeded(const std::string& vFileName, IGFD_ResultMode vFlag) const {
     auto result = vFileName;
     if (!result.empty()) {
-        const auto& current_filter = m_SelectedFilter.getFirstFilter();
+        const auto& current_filter = GetSelectedFilter().getFirstFilter();
         if (!current_filter.empty()) {
             Utils::ReplaceString(result, "..", ".");
 
@@ -1617,7 +3032,7 @@ std::string IGFD::FilterManager::ReplaceExtentionWithCurrentFilterIfNeeded(const
                 }
                 case IGFD_ResultMode_OverwriteFileExt: {
                     const auto& count_dots = Utils::GetCharCountInString(vFileName, '.');
-                    const auto& min_dots   = ImMin<size_t>(count_dots, m_SelectedFilter.count_dots);
+                    const auto& min_dots   = ImMin<size_t>(count_dots, GetSelectedFilter().count_dots);
                     const auto& lp         = Utils::GetLastCharPosWithMinCharCount(vFileName, '.', min_dots);
                     if (lp != std::string::npos) {  // there is a user extention
                         const auto& file_name_without_user_ext = vFileName.substr(0, lp);
@@ -1629,7 +3044,7 @@ std::string IGFD::FilterManager::ReplaceExtentionWithCurrentFilterIfNeeded(const
                 }
                 case IGFD_ResultMode_AddIfNoFileExt: {
                     const auto& count_dots = Utils::GetCharCountInString(vFileName, '.');
-                    const auto& min_dots   = ImMin<size_t>(count_dots, m_SelectedFilter.count_dots);
+                    const auto& min_dots   = ImMin<size_t>(count_dots, GetSelectedFilter().count_dots);
                     const auto& lp         = Utils::GetLastCharPosWithMinCharCount(vFileName, '.', min_dots);
                     if (lp == std::string::npos ||        // there is no user extention
                         lp == (vFileName.size() - 1U)) {  // or this pos is also the last char => considered like no user extention
@@ -1649,9 +3064,9 @@ std::string IGFD::FilterManager::ReplaceExtentionWithCurrentFilterIfNeeded(const
 }
 
 void IGFD::FilterManager::SetDefaultFilterIfNotDefined() {
-    if (m_SelectedFilter.empty() &&                   // no filter selected
-        !m_ParsedFilters.empty()) {                   // filter exist
-        m_SelectedFilter = *m_ParsedFilters.begin();  // we take the first filter
+    if (GetSelectedFilter().empty() &&  // no filter selected
+        !m_ParsedFilters.empty()) {     // filter exist
+        m_SelectFilter(0U);             // we take the first filter
     }
 }
 
@@ -1693,10 +3108,69 @@ bool IGFD::FileType::operator>(const FileType& rhs) const {
     return m_Content > rhs.m_Content;
 }
 
+std::shared_ptr<IGFD::FileInfosStore> IGFD::FileInfosStore::create() {
+    return std::make_shared<IGFD::FileInfosStore>();
+}
+
+// the slots have the size of the first allocation, a FileInfos with his control block. a released slot is reused first,
+// else a never used slot of the last block, else a new block. a size or an alignment not fitting a slot is allocated by operator new
+void* IGFD::FileInfosStore::Allocate(size_t vSize, size_t vAlign) {
+    const size_t slot_size = (std::max)((vSize + alignof(std::max_align_t) - 1U) & ~(alignof(std::max_align_t) - 1U), sizeof(FreeSlot));
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (m_SlotSize == 0U && vAlign <= alignof(std::max_align_t) && slot_size <= FILE_INFOS_STORE_BLOCK_SIZE) {
+        m_SlotSize = slot_size;
+    }
+    if (slot_size != m_SlotSize || vAlign > alignof(std::max_align_t)) {
+        return ::operator new(vSize);
+    }
+    ++m_CountUsedSlots;
+    if (m_FreeSlots != nullptr) {
+        auto* slot_ptr = m_FreeSlots;
+        m_FreeSlots    = slot_ptr->next;
+        return slot_ptr;
+    }
+    if (m_Blocks.empty() || m_BlockOffset + m_SlotSize > FILE_INFOS_STORE_BLOCK_SIZE) {
+        m_Blocks.emplace_back(new uint8_t[FILE_INFOS_STORE_BLOCK_SIZE]);  // aligned for max_align_t
+        m_BlockOffset = 0U;
+    }
+    void* ptr = m_Blocks.back().get() + m_BlockOffset;
+    m_BlockOffset += m_SlotSize;
+    return ptr;
+}
+
+void IGFD::FileInfosStore::Deallocate(void* vPtr, size_t vSize, size_t vAlign) {
+    const size_t slot_size = (std::max)((vSize + alignof(std::max_align_t) - 1U) & ~(alignof(std::max_align_t) - 1U), sizeof(FreeSlot));
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (slot_size != m_SlotSize || vAlign > alignof(std::max_align_t)) {
+        ::operator delete(vPtr);
+        return;
+    }
+    --m_CountUsedSlots;
+    m_FreeSlots = new (vPtr) FreeSlot{m_FreeSlots};
+}
+
+size_t IGFD::FileInfosStore::GetCountBlocks() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Blocks.size();
+}
+
+size_t IGFD::FileInfosStore::GetCountUsedSlots() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_CountUsedSlots;
+}
+
 std::shared_ptr<IGFD::FileInfos> IGFD::FileInfos::create() {
     return std::make_shared<IGFD::FileInfos>();
 }
 
+// the FileInfos and his shared_ptr control block are allocated together in a slot of the store
+std::shared_ptr<IGFD::FileInfos> IGFD::FileInfos::create(const std::shared_ptr<FileInfosStore>& vStorePtr) {
+    if (vStorePtr != nullptr) {
+        return std::allocate_shared<IGFD::FileInfos>(FileInfosStore::Allocator<IGFD::FileInfos>(vStorePtr));
+    }
+    return std::make_shared<IGFD::FileInfos>();
+}
+
 bool IGFD::FileInfos::SearchForTag(const std::string& vTag) const {
     if (!vTag.empty()) {
         if (fileNameExt_optimized == "..") return true;
@@ -1710,16 +3184,15 @@ bool IGFD::FileInfos::SearchForTag(const std::string& vTag) const {
 
 bool IGFD::FileInfos::SearchForExt(const std::string& vExt, const bool& vIsCaseInsensitive, const size_t& vMaxLevel) const {
     if (!vExt.empty()) {
-        const auto& ext_to_check = vIsCaseInsensitive ? Utils::LowerCaseString(vExt) : vExt;
-        const auto& ext_levels   = vIsCaseInsensitive ? fileExtLevels_optimized : fileExtLevels;
         if (vMaxLevel >= 1 && countExtDot >= vMaxLevel) {
-            for (const auto& ext : ext_levels) {
-                if (!ext.empty() && ext == ext_to_check) {
+            const auto& ext_to_check = vIsCaseInsensitive ? Utils::LowerCaseString(vExt) : vExt;
+            for (size_t lvl = 0U; lvl < GetCountExtLevels(); ++lvl) {
+                if (ext_to_check == (vIsCaseInsensitive ? GetFileExtLevelOptimized(lvl) : GetFileExtLevel(lvl))) {
                     return true;
                 }
             }
         } else {
-            return (fileExtLevels[0] == vExt);
+            return (vExt == GetFileExtLevel(0U));
         }
     }
     return false;
@@ -1738,38 +3211,30 @@ bool IGFD::FileInfos::SearchForExts(const std::string& vComaSepExts, const bool&
 }
 
 bool IGFD::FileInfos::FinalizeFileTypeParsing(const size_t& vMaxDotToExtract) {
+    m_CountExtLevels = 0U;
+    countExtDot      = 0U;
     if (fileType.isFile() || fileType.isLinkToUnknown()) {  // link can have the same extention of a file
-        countExtDot = Utils::GetCharCountInString(fileNameExt, '.');
-        size_t lpt  = 0U;
-        if (countExtDot > 1U) {  // multi layer ext
-            size_t max_dot_to_extract = vMaxDotToExtract;
-            if (max_dot_to_extract > countExtDot) {
-                max_dot_to_extract = countExtDot;
-            }
-            lpt = Utils::GetLastCharPosWithMinCharCount(fileNameExt, '.', max_dot_to_extract);
-        } else {
-            lpt = fileNameExt.find_first_of('.');
-        }
-        if (lpt != std::string::npos) {
-            size_t lvl                   = 0U;
-            fileNameLevels[lvl]          = fileNameExt.substr(0, lpt);
-            fileNameLevels[lvl]          = Utils::LowerCaseString(fileNameLevels[lvl]);
-            fileExtLevels[lvl]           = fileNameExt.substr(lpt);
-            fileExtLevels_optimized[lvl] = Utils::LowerCaseString(fileExtLevels[lvl]);
-            if (countExtDot > 1U) {  // multi layer ext
-                auto count = countExtDot;
-                while (count > 0 && lpt != std::string::npos && lvl < fileExtLevels.size()) {
-                    ++lpt; ++lvl;
-                    if (fileNameExt.size() > lpt) {
-                        lpt = fileNameExt.find_first_of('.', lpt);
-                        if (lpt != std::string::npos) {
-                            fileNameLevels[lvl]          = fileNameExt.substr(0, lpt);
-                            fileNameLevels[lvl]          = Utils::LowerCaseString(fileNameLevels[lvl]);
-                            fileExtLevels[lvl]           = fileNameExt.substr(lpt);
-                            fileExtLevels_optimized[lvl] = Utils::LowerCaseString(fileExtLevels[lvl]);
-                        }
-                    }
+        // one backward pass on the file name, the dot of the level 0 is the vMaxDotToExtract'th from the end (or the only one)
+        // so only the dots before this count are kept, in a ring of EXT_MAX_LEVEL dots
+        const size_t max_dots = (std::max)(vMaxDotToExtract, (size_t)1U);
+        std::array<size_t, EXT_MAX_LEVEL> dots_ring = {};
+        for (size_t idx = fileNameExt.size(); idx > 0U; --idx) {
+            if (fileNameExt[idx - 1U] == '.') {
+                if (countExtDot < max_dots) {
+                    dots_ring[countExtDot % EXT_MAX_LEVEL] = idx - 1U;
                 }
+                ++countExtDot;
+            }
+        }
+        size_t count_dots_to_extract = 1U;
+        if (countExtDot > 1U) {  // multi layer ext
+            count_dots_to_extract = (std::min)(vMaxDotToExtract, countExtDot);
+        }
+        if (countExtDot > 0U && fileNameExt.size() <= UINT16_MAX) {
+            // level 0 is the most left dot of the extracted ones, the next levels are the next dots on the right
+            for (size_t lvl = 0U; lvl < count_dots_to_extract && lvl < EXT_MAX_LEVEL; ++lvl) {
+                m_ExtLevelDotPositions[lvl] = (uint16_t)dots_ring[(count_dots_to_extract - 1U - lvl) % EXT_MAX_LEVEL];
+                ++m_CountExtLevels;
             }
         }
         return true;
@@ -1777,6 +3242,58 @@ bool IGFD::FileInfos::FinalizeFileTypeParsing(const size_t& vMaxDotToExtract) {
     return false;
 }
 
+const std::string& IGFD::FileInfos::GetFilePath() const {
+    static const std::string empty_path;
+    if (m_FilePathPtr != nullptr) {
+        return *m_FilePathPtr;
+    }
+    return empty_path;
+}
+
+const std::shared_ptr<const std::string>& IGFD::FileInfos::GetFilePathPtr() const {
+    return m_FilePathPtr;
+}
+
+void IGFD::FileInfos::SetFilePath(const std::string& vFilePath) {
+    m_FilePathPtr = std::make_shared<const std::string>(vFilePath);
+}
+
+void IGFD::FileInfos::SetFilePath(const std::shared_ptr<const std::string>& vFilePathPtr) {
+    m_FilePathPtr = vFilePathPtr;
+}
+
+size_t IGFD::FileInfos::GetCountExtLevels() const {
+    return m_CountExtLevels;
+}
+
+const char* IGFD::FileInfos::GetFileExtLevel(size_t vLevel) const {
+    if (vLevel < m_CountExtLevels && m_ExtLevelDotPositions[vLevel] < fileNameExt.size()) {
+        return fileNameExt.c_str() + m_ExtLevelDotPositions[vLevel];
+    }
+    return "";
+}
+
+const char* IGFD::FileInfos::GetFileExtLevelOptimized(size_t vLevel) const {
+    if (vLevel < m_CountExtLevels && m_ExtLevelDotPositions[vLevel] < fileNameExt_optimized.size()) {
+        return fileNameExt_optimized.c_str() + m_ExtLevelDotPositions[vLevel];
+    }
+    return "";
+}
+
+std::string IGFD::FileInfos::GetFileNameLevel(size_t vLevel) const {
+    if (vLevel < m_CountExtLevels && m_ExtLevelDotPositions[vLevel] < fileNameExt.size()) {
+        return fileNameExt.substr(0U, m_ExtLevelDotPositions[vLevel]);
+    }
+    return {};
+}
+
+std::string IGFD::FileInfos::GetFileNameLevelOptimized(size_t vLevel) const {
+    if (vLevel < m_CountExtLevels && m_ExtLevelDotPositions[vLevel] < fileNameExt_optimized.size()) {
+        return fileNameExt_optimized.substr(0U, m_ExtLevelDotPositions[vLevel]);
+    }
+    return {};
+}
+
 IGFD::FileManager::FileManager() {
     fsRoot           = IGFD::Utils::GetPathSeparator();
 #define STR(x)              #x
@@ -1789,6 +3306,13 @@ IGFD::FileManager::FileManager() {
     // m_FileSystemPtr = std::make_unique<FILE_SYSTEM_OVERRIDE>();
 }
 
+IGFD::FileManager::~FileManager() {
+    m_StopAsyncSearch();
+    m_StopAsyncScan();
+    m_MetadataThread.reset();  // will stop the lazy metadata loader and wait for his end
+    m_StopDirectoryWatch();
+}
+
 void IGFD::FileManager::OpenCurrentPath(const FileDialogInternal& vFileDialogInternal) {
     showDevices = false;
     ClearComposer();
@@ -1802,22 +3326,337 @@ void IGFD::FileManager::OpenCurrentPath(const FileDialogInternal& vFileDialogInt
 }
 
 void IGFD::FileManager::SortFields(const FileDialogInternal& vFileDialogInternal) {
-    m_SortFields(vFileDialogInternal, m_FileList, m_FilteredFileList);
+    (void)vFileDialogInternal;
+    m_DirtyListingStages |= ListingStageFlags_Sort;  // applied by ManageListingStages
+}
+
+// the files of all the filters are in m_FileList, classified by FileInfos::filtersMask, so the directory is not scanned again
+void IGFD::FileManager::ApplySelectedFilter(const FileDialogInternal& vFileDialogInternal) {
+    if (IsScanningDirectory()) {  // the scan thread parse the ext levels of the previous selected filter
+        m_DirtyListingStages |= ListingStageFlags_Scan;
+        return;
+    }
+    if (dLGDirectoryMode) {  // like OpenCurrentPath
+        SetDefaultFileName(".");
+    } else {
+        SetDefaultFileName(dLGDefaultFileName);
+    }
+    m_DirtyListingStages |= ListingStageFlags_Filter;
+    if (m_UpdateFilesExtLevels(vFileDialogInternal, m_FileList)) {  // the sort by type use the ext level 0
+        m_DirtyListingStages |= ListingStageFlags_Sort;
+    }
+}
+
+// the file list is made by stages, each one working on the output of the previous ones, and done again only when dirty :
+// scan (m_FileList) => classify by the filters (FileInfos::filtersMask) => sort (m_SortedFileIndexes)
+// => directory mode, hidden files, selected filter and search (m_FilteredFileIndexes, in the sorting order, or by score for the fuzzy search)
+// so a new sorting only gather again the filtered files in the new order, and a new filter or hidden files flag don't scan the directory
+void IGFD::FileManager::ManageListingStages(const FileDialogInternal& vFileDialogInternal) {
+    const auto listing_flags = vFileDialogInternal.getDialogConfig().flags & (ImGuiFileDialogFlags_DontShowHiddenFiles | ImGuiFileDialogFlags_CaseInsensitiveExtentionFiltering);
+    if (m_ListingFlags >= 0 && listing_flags != m_ListingFlags) {  // changed since the scan, by FileDialog::SetFlags (negative if no scan, like for the devices list)
+        // the files covered by no filter are not kept, so they are scanned again for another case of the exts
+        m_DirtyListingStages |= ((listing_flags ^ m_ListingFlags) & ImGuiFileDialogFlags_CaseInsensitiveExtentionFiltering) ? ListingStageFlags_Scan : ListingStageFlags_Filter;
+        m_ListingFlags              = listing_flags;
+        m_FilesCountByFilterIsDirty = true;  // the hidden files are counted or not
+    }
+    const auto dirty_stages = m_DirtyListingStages;
+    m_DirtyListingStages    = ListingStageFlags_None;
+    if (dirty_stages & ListingStageFlags_Scan) {
+        OpenCurrentPath(vFileDialogInternal);  // all the stages
+    } else if (dirty_stages & ListingStageFlags_Sort) {
+        m_SortFileIndexes(vFileDialogInternal, m_FileList, m_SortedFileIndexes);
+        if (dirty_stages & ListingStageFlags_Filter) {
+            ApplyFilteringOnFileList(vFileDialogInternal);
+        } else {
+            m_ReorderFilteredFiles(vFileDialogInternal);
+        }
+    } else if (dirty_stages & ListingStageFlags_Filter) {
+        ApplyFilteringOnFileList(vFileDialogInternal);
+    }
+}
+
+// the sorting don't change which files are filtered, so they are gathered again in the new order without search them again
+void IGFD::FileManager::m_ReorderFilteredFiles(const FileDialogInternal& vFileDialogInternal) {
+    const auto& search_tag  = vFileDialogInternal.searchManager.searchTag;
+    const bool fuzzy_search = !search_tag.empty() && (vFileDialogInternal.getDialogConfig().flags & ImGuiFileDialogFlags_FuzzySearch);
+    if (fuzzy_search || IsSearchRunning() || m_SortedFileIndexes.size() != m_FileList.size()) {
+        // the ties of the fuzzy scores are in the sorting order, and the async results are for the previous order
+        ApplyFilteringOnFileList(vFileDialogInternal);
+        return;
+    }
+    std::vector<uint8_t> is_filtered(m_FileList.size(), 0U);
+    for (const auto& idx : m_FilteredFileIndexes) {
+        is_filtered[idx] = 1U;
+    }
+    m_FilteredFileIndexes.clear();
+    for (const auto& idx : m_SortedFileIndexes) {
+        if (is_filtered[idx] != 0U) {
+            m_FilteredFileIndexes.push_back(idx);
+        }
+    }
+    m_SearchStates.clear();  // in the previous order
+    if (!search_tag.empty()) {
+        m_PushSearchState(search_tag);
+    }
+}
+
+// the ext levels depend on the count_dots of the selected filter, so the type sorting key and the style of the files whose ext changed are made again
+bool IGFD::FileManager::m_UpdateFilesExtLevels(const FileDialogInternal& vFileDialogInternal, const std::vector<std::shared_ptr<FileInfos> >& vFileInfosList) {
+    const auto& count_dots = vFileDialogInternal.filterManager.GetSelectedFilter().count_dots;
+    std::vector<std::shared_ptr<FileInfos> > changed_files;
+    for (const auto& infos_ptr : vFileInfosList) {
+        if (infos_ptr == nullptr) {
+            continue;
+        }
+        // the ext levels point in fileNameExt, who is not changed by FinalizeFileTypeParsing, so the previous ones are still valid
+        const size_t previous_count_levels = infos_ptr->GetCountExtLevels();
+        std::array<const char*, EXT_MAX_LEVEL> previous_exts = {};
+        for (size_t lvl = 0U; lvl < previous_count_levels; ++lvl) {
+            previous_exts[lvl] = infos_ptr->GetFileExtLevel(lvl);
+        }
+        if (!infos_ptr->FinalizeFileTypeParsing(count_dots)) {
+            continue;
+        }
+        bool ext_levels_changed = (infos_ptr->GetCountExtLevels() != previous_count_levels);
+        for (size_t lvl = 0U; !ext_levels_changed && lvl < previous_count_levels; ++lvl) {  // all the levels are styled, the level 0 is sorted
+            ext_levels_changed = (strcmp(previous_exts[lvl], infos_ptr->GetFileExtLevel(lvl)) != 0);
+        }
+        if (ext_levels_changed) {
+            if (infos_ptr->naturalSortKeyKind == FileInfos::NaturalSortKeyKind::Ext) {
+                infos_ptr->naturalSortKeyKind = FileInfos::NaturalSortKeyKind::None;
+            }
+            infos_ptr->fileStyle = nullptr;
+            changed_files.push_back(infos_ptr);
+        }
+    }
+    if (!changed_files.empty()) {
+        const auto threads_count = (size_t)(std::max)(0, vFileDialogInternal.getDialogConfig().countScanThreads);
+        vFileDialogInternal.filterManager.FillFilesStyle(changed_files, threads_count);
+    }
+    return !changed_files.empty();
+}
+
+const std::vector<size_t>& IGFD::FileManager::GetFilesCountByFilter(const FileDialogInternal& vFileDialogInternal) {
+    if (m_FilesCountByFilterIsDirty) {
+        const bool hide_hidden_files = (vFileDialogInternal.getDialogConfig().flags & ImGuiFileDialogFlags_DontShowHiddenFiles) != 0;
+        m_FilesCountByFilter.assign(64U, 0U);
+        for (const auto& infos_ptr : m_FileList) {
+            // like m_IsFileListed, so only the dirs are counted in directory mode, and they are covered by no filter
+            if (infos_ptr == nullptr || (dLGDirectoryMode && !infos_ptr->fileType.isDir()) || (hide_hidden_files && M_IsHiddenFile(*infos_ptr))) {
+                continue;
+            }
+            auto mask = infos_ptr->filtersMask;
+            for (size_t bit = 0U; mask != 0U; ++bit, mask >>= 1U) {
+                m_FilesCountByFilter[bit] += (size_t)(mask & 1U);
+            }
+        }
+        m_FilesCountByFilterIsDirty = false;
+    }
+    return m_FilesCountByFilter;
+}
+
+// the keys are compared as bytes, the equal natural keys are ordered by the length of their strings, like Utils::NaturalCompare
+bool IGFD::FileManager::M_CompareSortKeys(const std::string& vA, const std::string& vB, const size_t vSizeA, const size_t vSizeB, const bool vDescendingOrder) {
+    const auto ret = vA.compare(vB);
+    if (ret == 0) {
+        return vDescendingOrder ? (vSizeA > vSizeB) : (vSizeA < vSizeB);
+    }
+    return vDescendingOrder ? (ret > 0) : (ret < 0);
 }
 
-bool IGFD::FileManager::M_SortStrings(const FileDialogInternal& vFileDialogInternal, const bool vInsensitiveCase, const bool vDescendingOrder, const std::string& vA, const std::string& vB) {
-    if (vFileDialogInternal.getDialogConfig().flags & ImGuiFileDialogFlags_NaturalSorting) {
-        return IGFD::Utils::NaturalCompare(vA, vB, vInsensitiveCase, vDescendingOrder);
-    } else if (vInsensitiveCase) {
-        const auto ret = stricmp(vA.c_str(), vB.c_str());
-        return vDescendingOrder ? (ret > 0) : (ret < 0);
+// the key of natural sorting is made once per file for the active sort field, then kept with the file (and so in the listing cache)
+// only the key of the last natural sort is kept, so a file carry one key, made again if the field change
+void IGFD::FileManager::m_PrepareNaturalSortKeys(const std::vector<std::shared_ptr<FileInfos> >& vFileInfosList) const {
+    FileInfos::NaturalSortKeyKind key_kind = FileInfos::NaturalSortKeyKind::None;
+    if (sortingField == SortingFieldEnum::FIELD_FILENAME) {
+        key_kind = FileInfos::NaturalSortKeyKind::Name;
+    } else if (sortingField == SortingFieldEnum::FIELD_TYPE) {
+        key_kind = FileInfos::NaturalSortKeyKind::Ext;
     } else {
-        const auto ret = strcmp(vA.c_str(), vB.c_str());
-        return vDescendingOrder ? (ret > 0) : (ret < 0);
+        return;
+    }
+    for (const auto& infos_ptr : vFileInfosList) {
+        if (infos_ptr == nullptr || infos_ptr->naturalSortKeyKind == key_kind) {
+            continue;
+        }
+        if (key_kind == FileInfos::NaturalSortKeyKind::Name) {
+            infos_ptr->naturalSortKey = Utils::GetNaturalSortKey(infos_ptr->fileNameExt);
+        } else {
+            infos_ptr->naturalSortKey = Utils::GetNaturalSortKey(infos_ptr->GetFileExtLevel(0U));
+        }
+        infos_ptr->naturalSortKeyKind = key_kind;
+    }
+}
+
+// only the indexes of the files are sorted, the files stay in the scan order
+// if vSortedCount is more than 0, the vSortedCount first indexes are already sorted, and only the next ones are sorted then merged
+// if vParallel, a full sort is done by many threads (see FileDialogConfig::parallelSortThreshold)
+template <typename T>
+void IGFD::FileManager::m_SortFileInfosList(const std::vector<std::shared_ptr<FileInfos> >& vFileInfosList, std::vector<uint32_t>& vSortedIndexes, size_t vSortedCount, bool vParallel, T vComparator) {
+    const auto index_comparator = [&vFileInfosList, &vComparator](const uint32_t& vA, const uint32_t& vB) -> bool {  //
+        return vComparator(vFileInfosList[vA], vFileInfosList[vB]);
+    };
+    if ((vSortedCount == 0U || vSortedCount > vSortedIndexes.size()) && vParallel) {
+        M_ParallelSortIndexes(vSortedIndexes, index_comparator);
+    } else if (vSortedCount == 0U || vSortedCount > vSortedIndexes.size()) {
+        std::sort(vSortedIndexes.begin(), vSortedIndexes.end(), index_comparator);
+    } else {
+        const auto middle = vSortedIndexes.begin() + (std::ptrdiff_t)vSortedCount;
+        std::sort(middle, vSortedIndexes.end(), index_comparator);
+        std::inplace_merge(vSortedIndexes.begin(), middle, vSortedIndexes.end(), index_comparator);
+    }
+}
+
+// the chunks are sorted by many threads, then merged two by two, also by many threads, until one remain
+template <typename T>
+void IGFD::FileManager::M_ParallelSortIndexes(std::vector<uint32_t>& vIndexes, T vComparator) {
+    const auto chunks = M_GetParallelSortChunks(vIndexes.size());
+    std::vector<size_t> bounds;  // the sorted ranges are [bounds[i], bounds[i + 1])
+    for (size_t idx = 0U; idx < chunks.first; ++idx) {
+        bounds.push_back(idx * chunks.second);
+    }
+    bounds.push_back(vIndexes.size());
+    const auto begin = vIndexes.begin();
+    Utils::ParallelFor(chunks.first, chunks.first, 1U, [&bounds, &begin, &vComparator](size_t vStart, size_t vEnd) {
+        for (size_t idx = vStart; idx < vEnd; ++idx) {
+            std::sort(begin + (std::ptrdiff_t)bounds[idx], begin + (std::ptrdiff_t)bounds[idx + 1U], vComparator);
+        }
+    });
+    while (bounds.size() > 2U) {
+        const size_t count_pairs = (bounds.size() - 1U) / 2U;
+        Utils::ParallelFor(count_pairs, count_pairs, 1U, [&bounds, &begin, &vComparator](size_t vStart, size_t vEnd) {
+            for (size_t idx = vStart; idx < vEnd; ++idx) {
+                std::inplace_merge(begin + (std::ptrdiff_t)bounds[idx * 2U], begin + (std::ptrdiff_t)bounds[idx * 2U + 1U], begin + (std::ptrdiff_t)bounds[idx * 2U + 2U], vComparator);
+            }
+        });
+        std::vector<size_t> merged_bounds;
+        for (size_t idx = 0U; idx < bounds.size(); idx += 2U) {
+            merged_bounds.push_back(bounds[idx]);
+        }
+        if (merged_bounds.back() != vIndexes.size()) {
+            merged_bounds.push_back(vIndexes.size());  // the last range had no pair
+        }
+        bounds.swap(merged_bounds);
+    }
+}
+
+// count of chunks and size of a chunk, for a parallel sort of vCount entries
+std::pair<size_t, size_t> IGFD::FileManager::M_GetParallelSortChunks(size_t vCount) {
+    const size_t threads_count = (std::max)(1U, std::thread::hardware_concurrency());
+    const size_t max_chunks    = (std::max)((vCount + PARALLEL_SORT_MIN_CHUNK_SIZE - 1U) / PARALLEL_SORT_MIN_CHUNK_SIZE, (size_t)1U);
+    const size_t chunks_count  = (std::min)(threads_count, max_chunks);
+    return std::make_pair(chunks_count, (vCount + chunks_count - 1U) / chunks_count);
+}
+
+// stable LSD radix sort by 8 bits digits of the keys, the files of a chunk are counted and moved by the same thread
+// the file type is in the high byte of the key, so the directories first (or last) are kept, and vGetKey give the 56 low bits
+void IGFD::FileManager::M_RadixSortIndexes(const std::vector<std::shared_ptr<FileInfos> >& vFileInfosList, std::vector<uint32_t>& vIndexes, uint64_t (*vGetKey)(const FileInfos&), bool vDescendingOrder) {
+    struct KeyIndex {
+        uint64_t key;
+        uint32_t index;
+    };
+    static constexpr uint64_t SIZE_MASK = (1ULL << 56U) - 1ULL;
+    const size_t count = vIndexes.size();
+    std::vector<KeyIndex> entries(count);
+    std::vector<KeyIndex> swap_entries(count);
+    for (size_t idx = 0U; idx < count; ++idx) {
+        const auto& infos_ptr = vFileInfosList[vIndexes[idx]];
+        uint64_t type_rank    = 0U;
+        uint64_t size         = 0U;
+        if (infos_ptr != nullptr) {  // same order as FileType::ContentType
+            type_rank = infos_ptr->fileType.isDir() ? 1U : infos_ptr->fileType.isFile() ? 2U : infos_ptr->fileType.isLinkToUnknown() ? 3U : 0U;
+            size      = (std::min)(vGetKey(*infos_ptr), SIZE_MASK);
+        }
+        if (vDescendingOrder) {  // directories last, bigger first
+            type_rank = 3U - type_rank;
+            size      = SIZE_MASK - size;
+        }
+        entries[idx].key   = (type_rank << 56U) | size;
+        entries[idx].index = vIndexes[idx];
+    }
+    const auto chunks = M_GetParallelSortChunks(count);
+    std::vector<std::array<size_t, 256U> > histograms(chunks.first);
+    for (uint32_t shift = 0U; shift < 64U; shift += 8U) {
+        Utils::ParallelFor(chunks.first, chunks.first, 1U, [&](size_t vStart, size_t vEnd) {
+            for (size_t chunk = vStart; chunk < vEnd; ++chunk) {
+                auto& histogram = histograms[chunk];
+                histogram.fill(0U);
+                const size_t end = (std::min)((chunk + 1U) * chunks.second, count);
+                for (size_t idx = chunk * chunks.second; idx < end; ++idx) {
+                    ++histogram[(entries[idx].key >> shift) & 0xFFU];
+                }
+            }
+        });
+        // the offsets of a digit for a chunk are after the ones of the previous digits, and of the previous chunks
+        size_t offset          = 0U;
+        bool is_only_one_digit = false;
+        for (size_t digit = 0U; digit < 256U; ++digit) {
+            size_t count_digit = 0U;
+            for (auto& histogram : histograms) {
+                const size_t count_chunk = histogram[digit];
+                histogram[digit]         = offset + count_digit;
+                count_digit += count_chunk;
+            }
+            if (count_digit == count) {
+                is_only_one_digit = true;  // nothing to move for this digit
+            }
+            offset += count_digit;
+        }
+        if (is_only_one_digit) {
+            continue;
+        }
+        Utils::ParallelFor(chunks.first, chunks.first, 1U, [&](size_t vStart, size_t vEnd) {
+            for (size_t chunk = vStart; chunk < vEnd; ++chunk) {
+                auto& histogram  = histograms[chunk];
+                const size_t end = (std::min)((chunk + 1U) * chunks.second, count);
+                for (size_t idx = chunk * chunks.second; idx < end; ++idx) {
+                    swap_entries[histogram[(entries[idx].key >> shift) & 0xFFU]++] = entries[idx];
+                }
+            }
+        });
+        entries.swap(swap_entries);
     }
+    for (size_t idx = 0U; idx < count; ++idx) {
+        vIndexes[idx] = entries[idx].index;
+    }
+}
+
+uint64_t IGFD::FileManager::M_GetSizeSortKey(const FileInfos& vInfos) {
+    return (uint64_t)vInfos.fileSize;
 }
 
-void IGFD::FileManager::m_SortFields(const FileDialogInternal& vFileDialogInternal, std::vector<std::shared_ptr<FileInfos> >& vFileInfosList, std::vector<std::shared_ptr<FileInfos> >& vFileInfosFilteredList) {
+// the signed times are shifted for be sorted as unsigned keys of 56 bits
+uint64_t IGFD::FileManager::M_GetDateSortKey(const FileInfos& vInfos) {
+    static constexpr int64_t TIME_OFFSET = (int64_t)1 << 55;
+    const int64_t time = (std::max)((std::min)(vInfos.fileModifTime, TIME_OFFSET - 1), -TIME_OFFSET);
+    return (uint64_t)(time + TIME_OFFSET);
+}
+
+void IGFD::FileManager::m_SortFields(const FileDialogInternal& vFileDialogInternal, std::vector<std::shared_ptr<FileInfos> >& vFileInfosList, std::vector<uint32_t>& vSortedIndexes, std::vector<uint32_t>& vFilteredIndexes, size_t vSortedCount) {
+    m_SortFileIndexes(vFileDialogInternal, vFileInfosList, vSortedIndexes, vSortedCount);
+    m_ApplyFilteringOnFileList(vFileDialogInternal, vFileInfosList, vSortedIndexes, vFilteredIndexes);
+}
+
+void IGFD::FileManager::m_SortFileIndexes(const FileDialogInternal& vFileDialogInternal, std::vector<std::shared_ptr<FileInfos> >& vFileInfosList, std::vector<uint32_t>& vSortedIndexes, size_t vSortedCount) {
+    // the vSortedCount first indexes are kept, the indexes of the files added after them are appended
+    if (vSortedCount > vSortedIndexes.size() || vSortedCount > vFileInfosList.size()) {
+        vSortedCount = 0U;
+    }
+    vSortedIndexes.resize(vSortedCount);
+    for (size_t idx = vSortedCount; idx < vFileInfosList.size(); ++idx) {
+        vSortedIndexes.push_back((uint32_t)idx);
+    }
+    if (sortingField == SortingFieldEnum::FIELD_SIZE || sortingField == SortingFieldEnum::FIELD_DATE) {
+        m_LoadFilesMetadata(vFileDialogInternal, vFileInfosList);  // lazy metadata, the sort need them all
+    }
+    // the names are compared in insensitive case with their lower case copy, or with their natural sorting key
+    const bool natural_sorting = (vFileDialogInternal.getDialogConfig().flags & ImGuiFileDialogFlags_NaturalSorting) != 0;
+    if (natural_sorting) {
+        m_PrepareNaturalSortKeys(vFileInfosList);
+    }
+    const auto name_key = natural_sorting ? &FileInfos::naturalSortKey : &FileInfos::fileNameExt_optimized;
+    const auto parallel_threshold = vFileDialogInternal.getDialogConfig().parallelSortThreshold;
+    const bool parallel_sort      = parallel_threshold > 0 && vFileInfosList.size() >= (size_t)parallel_threshold;
     if (sortingField != SortingFieldEnum::FIELD_NONE) {
         headerFileName = tableHeaderFileNameString;
         headerFileType = tableHeaderFileTypeString;
@@ -1832,21 +3671,21 @@ void IGFD::FileManager::m_SortFields(const FileDialogInternal& vFileDialogIntern
 #ifdef USE_CUSTOM_SORTING_ICON
             headerFileName = tableHeaderAscendingIcon + headerFileName;
 #endif  // USE_CUSTOM_SORTING_ICON
-            std::sort(vFileInfosList.begin(), vFileInfosList.end(), //
-                      [&vFileDialogInternal](const std::shared_ptr<FileInfos>& a, const std::shared_ptr<FileInfos>& b) -> bool {
+            m_SortFileInfosList(vFileInfosList, vSortedIndexes, vSortedCount, parallel_sort, //
+                      [name_key](const std::shared_ptr<FileInfos>& a, const std::shared_ptr<FileInfos>& b) -> bool {
                           if (!a.use_count() || !b.use_count()) return false;
-                          if (a->fileType != b->fileType) return (a->fileType < b->fileType);                      // directories first
-                          return M_SortStrings(vFileDialogInternal, true, false, a->fileNameExt, b->fileNameExt);  // sort in insensitive case
+                          if (a->fileType != b->fileType) return (a->fileType < b->fileType);                                                // directories first
+                          return M_CompareSortKeys((*a).*name_key, (*b).*name_key, a->fileNameExt.size(), b->fileNameExt.size(), false);  // sort in insensitive case
                       });
         } else {
 #ifdef USE_CUSTOM_SORTING_ICON
             headerFileName = tableHeaderDescendingIcon + headerFileName;
 #endif // USE_CUSTOM_SORTING_ICON
-            std::sort(vFileInfosList.begin(), vFileInfosList.end(),  //
-                      [&vFileDialogInternal](const std::shared_ptr<FileInfos>& a, const std::shared_ptr<FileInfos>& b) -> bool {
+            m_SortFileInfosList(vFileInfosList, vSortedIndexes, vSortedCount, parallel_sort,  //
+                      [name_key](const std::shared_ptr<FileInfos>& a, const std::shared_ptr<FileInfos>& b) -> bool {
                           if (!a.use_count() || !b.use_count()) return false;
-                          if (a->fileType != b->fileType) return (a->fileType > b->fileType);                     // directories last
-                          return M_SortStrings(vFileDialogInternal, true, true, a->fileNameExt, b->fileNameExt);  // sort in insensitive case
+                          if (a->fileType != b->fileType) return (a->fileType > b->fileType);                                               // directories last
+                          return M_CompareSortKeys((*a).*name_key, (*b).*name_key, a->fileNameExt.size(), b->fileNameExt.size(), true);  // sort in insensitive case
                       });
         }
     } else if (sortingField == SortingFieldEnum::FIELD_TYPE) {
@@ -1854,19 +3693,21 @@ void IGFD::FileManager::m_SortFields(const FileDialogInternal& vFileDialogIntern
 #ifdef USE_CUSTOM_SORTING_ICON
             headerFileType = tableHeaderAscendingIcon + headerFileType;
 #endif  // USE_CUSTOM_SORTING_ICON
-            std::sort(vFileInfosList.begin(), vFileInfosList.end(), [&vFileDialogInternal](const std::shared_ptr<FileInfos>& a, const std::shared_ptr<FileInfos>& b) -> bool {
+            m_SortFileInfosList(vFileInfosList, vSortedIndexes, vSortedCount, parallel_sort, [natural_sorting](const std::shared_ptr<FileInfos>& a, const std::shared_ptr<FileInfos>& b) -> bool {
                 if (!a.use_count() || !b.use_count()) return false;
                 if (a->fileType != b->fileType) return (a->fileType < b->fileType);  // directory in first
-                return M_SortStrings(vFileDialogInternal, true, false, a->fileExtLevels[0], b->fileExtLevels[0]);  // sort in sensitive case
+                if (natural_sorting) return M_CompareSortKeys(a->naturalSortKey, b->naturalSortKey, strlen(a->GetFileExtLevel(0U)), strlen(b->GetFileExtLevel(0U)), false);
+                return strcmp(a->GetFileExtLevelOptimized(0U), b->GetFileExtLevelOptimized(0U)) < 0;  // sort in insensitive case
             });
         } else {
 #ifdef USE_CUSTOM_SORTING_ICON
             headerFileType = tableHeaderDescendingIcon + headerFileType;
 #endif  // USE_CUSTOM_SORTING_ICON
-            std::sort(vFileInfosList.begin(), vFileInfosList.end(), [&vFileDialogInternal](const std::shared_ptr<FileInfos>& a, const std::shared_ptr<FileInfos>& b) -> bool {
+            m_SortFileInfosList(vFileInfosList, vSortedIndexes, vSortedCount, parallel_sort, [natural_sorting](const std::shared_ptr<FileInfos>& a, const std::shared_ptr<FileInfos>& b) -> bool {
                 if (!a.use_count() || !b.use_count()) return false;
                 if (a->fileType != b->fileType) return (a->fileType > b->fileType);  // directory in last
-                return M_SortStrings(vFileDialogInternal, true, true, a->fileExtLevels[0], b->fileExtLevels[0]);  // sort in sensitive case
+                if (natural_sorting) return M_CompareSortKeys(a->naturalSortKey, b->naturalSortKey, strlen(a->GetFileExtLevel(0U)), strlen(b->GetFileExtLevel(0U)), true);
+                return strcmp(a->GetFileExtLevelOptimized(0U), b->GetFileExtLevelOptimized(0U)) > 0;  // sort in insensitive case
             });
         }
     } else if (sortingField == SortingFieldEnum::FIELD_SIZE) {
@@ -1874,40 +3715,56 @@ void IGFD::FileManager::m_SortFields(const FileDialogInternal& vFileDialogIntern
 #ifdef USE_CUSTOM_SORTING_ICON
             headerFileSize = tableHeaderAscendingIcon + headerFileSize;
 #endif  // USE_CUSTOM_SORTING_ICON
-            std::sort(vFileInfosList.begin(), vFileInfosList.end(), [](const std::shared_ptr<FileInfos>& a, const std::shared_ptr<FileInfos>& b) -> bool {
-                if (!a.use_count() || !b.use_count()) return false;
-                if (a->fileType != b->fileType) return (a->fileType < b->fileType);  // directory in first
-                return (a->fileSize < b->fileSize);                                  // else
-            });
+            if (parallel_sort && vSortedCount == 0U) {
+                M_RadixSortIndexes(vFileInfosList, vSortedIndexes, M_GetSizeSortKey, false);
+            } else {
+                m_SortFileInfosList(vFileInfosList, vSortedIndexes, vSortedCount, parallel_sort, [](const std::shared_ptr<FileInfos>& a, const std::shared_ptr<FileInfos>& b) -> bool {
+                    if (!a.use_count() || !b.use_count()) return false;
+                    if (a->fileType != b->fileType) return (a->fileType < b->fileType);  // directory in first
+                    return (a->fileSize < b->fileSize);                                  // else
+                });
+            }
         } else {
 #ifdef USE_CUSTOM_SORTING_ICON
             headerFileSize = tableHeaderDescendingIcon + headerFileSize;
 #endif  // USE_CUSTOM_SORTING_ICON
-            std::sort(vFileInfosList.begin(), vFileInfosList.end(), [](const std::shared_ptr<FileInfos>& a, const std::shared_ptr<FileInfos>& b) -> bool {
-                if (!a.use_count() || !b.use_count()) return false;
-                if (a->fileType != b->fileType) return (a->fileType > b->fileType);  // directory in last
-                return (a->fileSize > b->fileSize);                                  // else
-            });
+            if (parallel_sort && vSortedCount == 0U) {
+                M_RadixSortIndexes(vFileInfosList, vSortedIndexes, M_GetSizeSortKey, true);
+            } else {
+                m_SortFileInfosList(vFileInfosList, vSortedIndexes, vSortedCount, parallel_sort, [](const std::shared_ptr<FileInfos>& a, const std::shared_ptr<FileInfos>& b) -> bool {
+                    if (!a.use_count() || !b.use_count()) return false;
+                    if (a->fileType != b->fileType) return (a->fileType > b->fileType);  // directory in last
+                    return (a->fileSize > b->fileSize);                                  // else
+                });
+            }
         }
     } else if (sortingField == SortingFieldEnum::FIELD_DATE) {
         if (sortingDirection[3]) {
 #ifdef USE_CUSTOM_SORTING_ICON
             headerFileDate = tableHeaderAscendingIcon + headerFileDate;
 #endif  // USE_CUSTOM_SORTING_ICON
-            std::sort(vFileInfosList.begin(), vFileInfosList.end(), [](const std::shared_ptr<FileInfos>& a, const std::shared_ptr<FileInfos>& b) -> bool {
-                if (!a.use_count() || !b.use_count()) return false;
-                if (a->fileType != b->fileType) return (a->fileType < b->fileType);  // directory in first
-                return (a->fileModifDate < b->fileModifDate);                        // else
-            });
+            if (parallel_sort && vSortedCount == 0U) {
+                M_RadixSortIndexes(vFileInfosList, vSortedIndexes, M_GetDateSortKey, false);
+            } else {
+                m_SortFileInfosList(vFileInfosList, vSortedIndexes, vSortedCount, parallel_sort, [](const std::shared_ptr<FileInfos>& a, const std::shared_ptr<FileInfos>& b) -> bool {
+                    if (!a.use_count() || !b.use_count()) return false;
+                    if (a->fileType != b->fileType) return (a->fileType < b->fileType);  // directory in first
+                    return (a->fileModifTime < b->fileModifTime);                        // else
+                });
+            }
         } else {
 #ifdef USE_CUSTOM_SORTING_ICON
             headerFileDate = tableHeaderDescendingIcon + headerFileDate;
 #endif  // USE_CUSTOM_SORTING_ICON
-            std::sort(vFileInfosList.begin(), vFileInfosList.end(), [](const std::shared_ptr<FileInfos>& a, const std::shared_ptr<FileInfos>& b) -> bool {
-                if (!a.use_count() || !b.use_count()) return false;
-                if (a->fileType != b->fileType) return (a->fileType > b->fileType);  // directory in last
-                return (a->fileModifDate > b->fileModifDate);                        // else
-            });
+            if (parallel_sort && vSortedCount == 0U) {
+                M_RadixSortIndexes(vFileInfosList, vSortedIndexes, M_GetDateSortKey, true);
+            } else {
+                m_SortFileInfosList(vFileInfosList, vSortedIndexes, vSortedCount, parallel_sort, [](const std::shared_ptr<FileInfos>& a, const std::shared_ptr<FileInfos>& b) -> bool {
+                    if (!a.use_count() || !b.use_count()) return false;
+                    if (a->fileType != b->fileType) return (a->fileType > b->fileType);  // directory in last
+                    return (a->fileModifTime > b->fileModifTime);                        // else
+                });
+            }
         }
     }
 #ifdef USE_THUMBNAILS
@@ -1920,7 +3777,7 @@ void IGFD::FileManager::m_SortFields(const FileDialogInternal& vFileDialogIntern
 #ifdef USE_CUSTOM_SORTING_ICON
             headerFileThumbnails = tableHeaderAscendingIcon + headerFileThumbnails;
 #endif  // USE_CUSTOM_SORTING_ICON
-            std::sort(vFileInfosList.begin(), vFileInfosList.end(), [](const std::shared_ptr<FileInfos>& a, const std::shared_ptr<FileInfos>& b) -> bool {
+            m_SortFileInfosList(vFileInfosList, vSortedIndexes, vSortedCount, parallel_sort, [](const std::shared_ptr<FileInfos>& a, const std::shared_ptr<FileInfos>& b) -> bool {
                 if (!a.use_count() || !b.use_count()) return false;
                 if (a->fileType != b->fileType) return (a->fileType.isDir());  // directory in first
                 if (a->thumbnailInfo.textureWidth == b->thumbnailInfo.textureWidth) return (a->thumbnailInfo.textureHeight < b->thumbnailInfo.textureHeight);
@@ -1932,7 +3789,7 @@ void IGFD::FileManager::m_SortFields(const FileDialogInternal& vFileDialogIntern
 #ifdef USE_CUSTOM_SORTING_ICON
             headerFileThumbnails = tableHeaderDescendingIcon + headerFileThumbnails;
 #endif  // USE_CUSTOM_SORTING_ICON
-            std::sort(vFileInfosList.begin(), vFileInfosList.end(), [](const std::shared_ptr<FileInfos>& a, const std::shared_ptr<FileInfos>& b) -> bool {
+            m_SortFileInfosList(vFileInfosList, vSortedIndexes, vSortedCount, parallel_sort, [](const std::shared_ptr<FileInfos>& a, const std::shared_ptr<FileInfos>& b) -> bool {
                 if (!a.use_count() || !b.use_count()) return false;
                 if (a->fileType != b->fileType) return (!a->fileType.isDir());  // directory in last
                 if (a->thumbnailInfo.textureWidth == b->thumbnailInfo.textureWidth) return (a->thumbnailInfo.textureHeight > b->thumbnailInfo.textureHeight);
@@ -1941,119 +3798,692 @@ void IGFD::FileManager::m_SortFields(const FileDialogInternal& vFileDialogIntern
         }
     }
 #endif  // USE_THUMBNAILS
+}
+
+bool IGFD::FileManager::m_CompleteFileInfosWithUserFileAttirbutes(const FileDialogConfig& vConfig, const std::shared_ptr<FileInfos>& vInfos) {
+    if (vConfig.userFileAttributes != nullptr) {
+        if (!vConfig.userFileAttributes(vInfos.get(), vConfig.userDatas)) {
+            return false;  // the file will be ignored, so not added to the file list, so not displayed
+        }
+        // the size maybe changed by the callback will be formated at the first display (FormatFileInfosMetadata)
+    }
+    return true; // file will be added to file list, so displayed
+}
+
+void IGFD::FileManager::ClearFileLists() {
+    m_StopAsyncSearch();
+    m_StopAsyncScan();
+    m_StopDirectoryWatch();
+    {
+        std::lock_guard<std::mutex> lock(m_MetadataMutex);
+        m_MetadataRequests.clear();  // the requests in progress will be ignored since their files will be expired
+        m_MetadataResults.clear();
+    }
+    m_SearchStates.clear();
+    m_FileNamesBlobPtr     = nullptr;
+    m_FileNamesCaseBlobPtr = nullptr;
+    m_FilteredFileIndexes.clear();
+    m_SortedFileIndexes.clear();
+    m_FileList.clear();
+    m_FilesCountByFilterIsDirty = true;
+    m_DirtyListingStages        = ListingStageFlags_None;
+    m_ListingFlags              = -1;  // no scanned listing, until the next ScanDir
+    m_FileInfosStorePtr         = FileInfosStore::create();  // the old one is released with his last FileInfos
+}
+
+void IGFD::FileManager::ClearPathLists() {
+    m_FilteredPathIndexes.clear();
+    m_SortedPathIndexes.clear();
+    m_PathList.clear();
+    m_PathInfosStorePtr = FileInfosStore::create();  // the old one is released with his last FileInfos
+}
+
+std::shared_ptr<IGFD::FileInfos> IGFD::FileManager::m_CreateFileInfos(const FileDialogConfig& vConfig, const FilterManager& vFilterManager, const std::shared_ptr<const std::string>& vPathPtr,
+                                                                      const DirectoryEntry& vScannedFile) {
+    auto infos_ptr = m_PrepareFileInfos(vConfig, vFilterManager, vPathPtr, vScannedFile, true);
+    if (infos_ptr != nullptr && m_CompleteFileInfosWithUserFileAttirbutes(vConfig, infos_ptr)) {
+        return infos_ptr;
+    }
+    return nullptr;
+}
+
+// all but the user file attributes callback, so can be called from many threads at same time
+// if not vFillStyleAndComplete, the style and the size/date infos are not filled, since the style functors are user callbacks too
+// and they must see the file infos as in the serial path (before m_CompleteFileInfos)
+std::shared_ptr<IGFD::FileInfos> IGFD::FileManager::m_PrepareFileInfos(const FileDialogConfig& vConfig, const FilterManager& vFilterManager, const std::shared_ptr<const std::string>& vPathPtr,
+                                                                       const DirectoryEntry& vScannedFile, bool vFillStyleAndComplete) const {
+    auto infos_ptr = FileInfos::create(m_FileInfosStorePtr);  // not replaced during a scan, ClearFileLists stop the async scan before
+
+    infos_ptr->SetFilePath(vPathPtr);
+    infos_ptr->fileNameExt           = vScannedFile.fileNameExt;
+    infos_ptr->fileNameExt_optimized = Utils::LowerCaseString(infos_ptr->fileNameExt);
+    infos_ptr->fileType              = vScannedFile.fileType;
+    infos_ptr->fileSize              = vScannedFile.fileSize;
+    infos_ptr->fileModifTime         = vScannedFile.fileModifTime;
+    infos_ptr->fileStatFilled        = vScannedFile.fileStatFilled;
+
+    if (infos_ptr->fileNameExt.empty() || (infos_ptr->fileNameExt == "." && !vFilterManager.dLGFilters.empty())) {  // filename empty or filename is the current dir '.' //-V807
+        return nullptr;
+    }
+
+    // the hidden files are kept, and not listed by m_IsFileListed, so ImGuiFileDialogFlags_DontShowHiddenFiles can change without scan the directory again
+    // the file is classified against all the filters, so the files of another filter are shown without scan the directory again
+    if (infos_ptr->fileType.isFile() || infos_ptr->fileType.isLinkToUnknown()) {  // like FileInfos::FinalizeFileTypeParsing
+        infos_ptr->filtersMask = vFilterManager.GetCoveringFiltersMask(*infos_ptr.get(), (vConfig.flags & ImGuiFileDialogFlags_CaseInsensitiveExtentionFiltering) != 0);
+        if (infos_ptr->filtersMask == 0U) {  // covered by no filter
+            return nullptr;
+        }
+    }
+    infos_ptr->FinalizeFileTypeParsing(vFilterManager.GetSelectedFilter().count_dots);  // the ext levels displayed, sorted and styled
+
+    if (vFillStyleAndComplete) {
+        vFilterManager.FillFileStyle(infos_ptr);
+        m_CompleteOrDeferFileInfos(vConfig, infos_ptr);
+    }
+
+    return infos_ptr;
+}
+
+void IGFD::FileManager::m_AddFile(const FileDialogInternal& vFileDialogInternal, const std::shared_ptr<const std::string>& vPathPtr, const DirectoryEntry& vScannedFile) {
+    auto infos_ptr = m_CreateFileInfos(vFileDialogInternal.getDialogConfig(), vFileDialogInternal.filterManager, vPathPtr, vScannedFile);
+    if (infos_ptr != nullptr) {
+        m_FileList.push_back(infos_ptr);
+    }
+}
+
+void IGFD::FileManager::m_AddPath(const FileDialogInternal& vFileDialogInternal, const std::shared_ptr<const std::string>& vPathPtr, const DirectoryEntry& vScannedFile) {
+    if (!vScannedFile.fileType.isDir()) return;
+
+    auto infos_ptr = FileInfos::create(m_PathInfosStorePtr);
+
+    infos_ptr->SetFilePath(vPathPtr);
+    infos_ptr->fileNameExt           = vScannedFile.fileNameExt;
+    infos_ptr->fileNameExt_optimized = Utils::LowerCaseString(infos_ptr->fileNameExt);
+    infos_ptr->fileType              = vScannedFile.fileType;
+    infos_ptr->fileSize              = vScannedFile.fileSize;
+    infos_ptr->fileModifTime         = vScannedFile.fileModifTime;
+    infos_ptr->fileStatFilled        = vScannedFile.fileStatFilled;
+
+    if (infos_ptr->fileNameExt.empty() || (infos_ptr->fileNameExt == "." && !vFileDialogInternal.filterManager.dLGFilters.empty())) {  // filename empty or filename is the current dir '.' //-V807
+        return;
+    }
+
+    if (infos_ptr->fileNameExt != ".." && (vFileDialogInternal.getDialogConfig().flags & ImGuiFileDialogFlags_DontShowHiddenFiles) && infos_ptr->fileNameExt[0] == '.') {           // dont show hidden files
+        if (!vFileDialogInternal.filterManager.dLGFilters.empty() || (vFileDialogInternal.filterManager.dLGFilters.empty() && infos_ptr->fileNameExt != ".")) {  // except "." if in directory mode //-V728
+            return;
+        }
+    }
+
+    vFileDialogInternal.filterManager.FillFileStyle(infos_ptr);
+
+    m_CompleteFileInfos(infos_ptr);
+
+    if (m_CompleteFileInfosWithUserFileAttirbutes(vFileDialogInternal.getDialogConfig(), infos_ptr)) {
+        m_PathList.push_back(infos_ptr);
+    }
+}
+
+void IGFD::FileManager::ScanDir(const FileDialogInternal& vFileDialogInternal, const std::string& vPath) {
+    std::string path = vPath;
+
+    if (m_CurrentPathDecomposition.empty()) {
+        SetCurrentDir(path);
+    }
+
+    if (!m_CurrentPathDecomposition.empty()) {
+#ifdef _IGFD_WIN_
+        if (path == fsRoot) {
+            path += IGFD::Utils::GetPathSeparator();
+        }
+#endif  // _IGFD_WIN_
+
+        ClearFileLists();
+        // the flags of the listing, for all the ways to fill it (cache, async or sync scan), checked by ManageListingStages
+        m_ListingFlags = vFileDialogInternal.getDialogConfig().flags & (ImGuiFileDialogFlags_DontShowHiddenFiles | ImGuiFileDialogFlags_CaseInsensitiveExtentionFiltering);
+
+        if (vFileDialogInternal.getDialogConfig().flags & ImGuiFileDialogFlags_WatchDirectory) {
+            m_StartDirectoryWatch(path);  // before the scan, so the changes during the scan are not lost
+        }
+
+        const auto path_ptr = std::make_shared<const std::string>(path);  // shared by all the files of the directory
+
+        CachedListing listing;
+        const bool can_be_cached = m_PrepareCachedListing(vFileDialogInternal, path, listing);  // the times are got before the scan
+        if (can_be_cached && m_RestoreCachedListing(path, listing)) {
+            m_UpdateFilesExtLevels(vFileDialogInternal, m_FileList);  // the listing can be cached with another selected filter
+            m_SortFields(vFileDialogInternal, m_FileList, m_SortedFileIndexes, m_FilteredFileIndexes);
+            return;
+        }
+
+        if (vFileDialogInternal.getDialogConfig().flags & ImGuiFileDialogFlags_AsyncDirectoryScan) {
+            m_StartAsyncScan(vFileDialogInternal, path);  // the files will be published by ManageAsyncScan
+            if (can_be_cached) {
+                m_PendingListingPath = path;  // the listing will be cached by ManageAsyncScan at the end of the scan
+                m_PendingListing     = std::move(listing);
+            }
+            return;
+        }
+
+        if (vFileDialogInternal.getDialogConfig().countScanThreads != 1) {
+            std::vector<DirectoryEntry> entries;  // the parallel completion need them all
+            m_VisitDirectory(vFileDialogInternal.getDialogConfig(), path, [&entries](const DirectoryEntry& vEntry) {
+                entries.push_back(vEntry);
+                return true;
+            });
+            m_AddFilesParallel(vFileDialogInternal, path_ptr, entries);
+        } else {
+            m_VisitDirectory(vFileDialogInternal.getDialogConfig(), path, [this, &vFileDialogInternal, &path_ptr](const DirectoryEntry& vEntry) {
+                m_AddFile(vFileDialogInternal, path_ptr, vEntry);
+                return true;
+            });
+        }
+
+        if (can_be_cached) {
+            m_StoreCachedListing(vFileDialogInternal, path, listing);
+        }
+
+        m_SortFields(vFileDialogInternal, m_FileList, m_SortedFileIndexes, m_FilteredFileIndexes);
+    }
+}
+
+// the files are prepared in parallel, by contiguous chunks, each one in its own slot, then styled by FilterManager::FillFilesStyle,
+// then the user callbacks are called serially in the scan order, so the file list is the same as with m_AddFile
+void IGFD::FileManager::m_CreateFilesInfos(const FileDialogConfig& vConfig, const FilterManager& vFilterManager, const std::shared_ptr<const std::string>& vPathPtr,
+                                           const std::vector<DirectoryEntry>& vScannedFiles, size_t vThreadsCount, std::vector<std::shared_ptr<FileInfos> >& vOutFiles) {
+    std::vector<std::shared_ptr<FileInfos> > prepared_files(vScannedFiles.size());
+    IGFD::Utils::ParallelFor(vScannedFiles.size(), vThreadsCount, PARALLEL_SCAN_MIN_CHUNK_SIZE, [&](size_t vStart, size_t vEnd) {
+        for (size_t idx = vStart; idx < vEnd; ++idx) {
+            prepared_files[idx] = m_PrepareFileInfos(vConfig, vFilterManager, vPathPtr, vScannedFiles[idx], false);
+        }
+    });
+    prepared_files.erase(std::remove(prepared_files.begin(), prepared_files.end(), nullptr), prepared_files.end());
+    vFilterManager.FillFilesStyle(prepared_files, vThreadsCount);  // before the completion, as in m_PrepareFileInfos
+    IGFD::Utils::ParallelFor(prepared_files.size(), vThreadsCount, PARALLEL_SCAN_MIN_CHUNK_SIZE, [&](size_t vStart, size_t vEnd) {
+        for (size_t idx = vStart; idx < vEnd; ++idx) {
+            m_CompleteOrDeferFileInfos(vConfig, prepared_files[idx]);
+        }
+    });
+    vOutFiles.reserve(vOutFiles.size() + prepared_files.size());
+    for (const auto& infos_ptr : prepared_files) {
+        if (m_CompleteFileInfosWithUserFileAttirbutes(vConfig, infos_ptr)) {
+            vOutFiles.push_back(infos_ptr);
+        }
+    }
+}
+
+void IGFD::FileManager::m_AddFilesParallel(const FileDialogInternal& vFileDialogInternal, const std::shared_ptr<const std::string>& vPathPtr, const std::vector<DirectoryEntry>& vScannedFiles) {
+    const auto threads_count = (size_t)(std::max)(0, vFileDialogInternal.getDialogConfig().countScanThreads);
+    m_CreateFilesInfos(vFileDialogInternal.getDialogConfig(), vFileDialogInternal.filterManager, vPathPtr, vScannedFiles, threads_count, m_FileList);
+}
+
+void IGFD::FileManager::m_StartAsyncScan(const FileDialogInternal& vFileDialogInternal, const std::string& vPath) {
+    m_StopAsyncScan();
+    m_ScanIsWorking = true;
+    // the thread read only his copies of the config and of the filters, since the dialog can change during the scan (FileDialog::SetFlags, filter combobox, SetFileStyle..)
+    m_ScanThread = std::shared_ptr<std::thread>(new std::thread(&IGFD::FileManager::m_ThreadAsyncScanFunc, this, std::make_shared<const FileDialogConfig>(vFileDialogInternal.getDialogConfig()),
+                                                                std::make_shared<const FilterManager>(vFileDialogInternal.filterManager), vPath),
+                                                [this](std::thread* obj_ptr) {
+                                                    m_ScanIsWorking = false;
+                                                    if (obj_ptr != nullptr) {
+                                                        obj_ptr->join();
+                                                        delete obj_ptr;
+                                                    }
+                                                });
+}
+
+void IGFD::FileManager::m_StopAsyncScan() {
+    m_ScanThread.reset();  // will cancel the scan and join the thread
+    std::lock_guard<std::mutex> lock(m_ScanBatchMutex);
+    m_ScanBatch.clear();
+    m_ScanIsDone       = false;
+    m_ScanExceptionPtr = nullptr;
+    m_ScanCountEntries = 0U;
+    m_PendingListingPath.clear();  // a cancelled scan is not cached
+}
+
+// the files are created here, and published by batches in ManageAsyncScan from the main thread
+// the user callbacks (userFileAttributes and file style functors) are called from this thread
+// the entries are created by batches, so the batch style functors are called once per batch
+void IGFD::FileManager::m_ThreadAsyncScanFunc(std::shared_ptr<const FileDialogConfig> vConfigPtr, std::shared_ptr<const FilterManager> vFilterManagerPtr, std::string vPath) {
+    const auto& config        = *vConfigPtr;
+    const auto& filterManager = *vFilterManagerPtr;
+    std::vector<DirectoryEntry> entries;
+    std::vector<std::shared_ptr<FileInfos> > batch;
+    const auto path_ptr      = std::make_shared<const std::string>(vPath);  // shared by all the files of the directory
+    const auto threads_count = (size_t)(std::max)(0, config.countScanThreads);
+    try {
+        m_VisitDirectory(config, vPath, [this, &config, &filterManager, &path_ptr, &entries, &batch, threads_count](const DirectoryEntry& vEntry) {
+            if (!m_ScanIsWorking) {
+                return false;  // cancelled
+            }
+            entries.push_back(vEntry);
+            ++m_ScanCountEntries;
+            if (entries.size() >= ASYNC_SCAN_BATCH_SIZE) {
+                m_CreateFilesInfos(config, filterManager, path_ptr, entries, threads_count, batch);
+                entries.clear();
+                std::lock_guard<std::mutex> lock(m_ScanBatchMutex);
+                m_ScanBatch.insert(m_ScanBatch.end(), batch.begin(), batch.end());
+                batch.clear();
+            }
+            return true;
+        });
+        if (!m_ScanIsWorking) {
+            return;  // cancelled
+        }
+        m_CreateFilesInfos(config, filterManager, path_ptr, entries, threads_count, batch);
+    } catch (...) {  // an exception would terminate the program from this thread, so it's given to the main thread
+        std::lock_guard<std::mutex> lock(m_ScanBatchMutex);
+        m_ScanExceptionPtr = std::current_exception();
+        m_ScanIsDone       = true;
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_ScanBatchMutex);
+    m_ScanBatch.insert(m_ScanBatch.end(), batch.begin(), batch.end());
+    m_ScanIsDone = true;
+}
+
+void IGFD::FileManager::ManageAsyncScan(const FileDialogInternal& vFileDialogInternal) {
+    if (m_ScanThread == nullptr) {
+        return;
+    }
+    std::vector<std::shared_ptr<FileInfos> > batch;
+    std::exception_ptr exception_ptr = nullptr;
+    bool is_done                     = false;
+    {
+        std::lock_guard<std::mutex> lock(m_ScanBatchMutex);
+        batch.swap(m_ScanBatch);
+        is_done = m_ScanIsDone;
+        exception_ptr.swap(m_ScanExceptionPtr);
+    }
+    if (is_done) {
+        m_ScanThread.reset();
+        m_ScanIsDone       = false;
+        m_ScanCountEntries = 0U;
+        if (exception_ptr != nullptr) {  // the files already published are kept, the listing is not cached
+            m_PendingListingPath.clear();
+            m_SortFields(vFileDialogInternal, m_FileList, m_SortedFileIndexes, m_FilteredFileIndexes);
+            std::rethrow_exception(exception_ptr);
+        }
+        m_FileList.insert(m_FileList.end(), batch.begin(), batch.end());
+        if (!m_PendingListingPath.empty()) {
+            m_StoreCachedListing(vFileDialogInternal, m_PendingListingPath, m_PendingListing);
+            m_PendingListingPath.clear();
+        }
+        m_SortFields(vFileDialogInternal, m_FileList, m_SortedFileIndexes, m_FilteredFileIndexes);
+    } else if (!batch.empty()) {
+        // the new files are displayed at the end of the list, the sorting is done once at the end of the scan
+        for (const auto& file : batch) {
+            if (m_IsFileShown(vFileDialogInternal, file)) {
+                m_FilteredFileIndexes.push_back((uint32_t)m_FileList.size());
+            }
+            m_FileList.push_back(file);
+        }
+        m_FilesCountByFilterIsDirty = true;
+    }
+}
 
-    m_ApplyFilteringOnFileList(vFileDialogInternal, vFileInfosList, vFileInfosFilteredList);
+void IGFD::FileManager::m_VisitDirectory(const FileDialogConfig& vConfig, const std::string& vPath, const DirectoryEntryVisitor& vVisitor) {
+    const bool with_stat = !(vConfig.flags & ImGuiFileDialogFlags_LazyMetadata);
+    m_FileSystemPtr->VisitDirectory(vPath, with_stat, vVisitor);
+}
+
+void IGFD::FileManager::m_CompleteOrDeferFileInfos(const FileDialogConfig& vConfig, const std::shared_ptr<FileInfos>& vInfos) {
+    if (vConfig.flags & ImGuiFileDialogFlags_LazyMetadata) {
+        vInfos->fileMetadataState = FileInfos::MetadataState::NotLoaded;  // will be loaded when displayed or sorted by size/date
+    } else {
+        m_CompleteFileInfos(vInfos);
+    }
+}
+
+// the loader work only on copies of the files (MetadataRequest::loadInfos),
+// the displayed files are only modified by the main thread in ManageLazyMetadata
+void IGFD::FileManager::m_ThreadMetadataFunc() {
+    std::vector<MetadataRequest> requests;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_MetadataMutex);
+            m_MetadataCondition.wait(lock, [this]() { return m_MetadataThreadStop || !m_MetadataRequests.empty(); });
+            if (m_MetadataThreadStop) {
+                return;
+            }
+            requests.swap(m_MetadataRequests);
+        }
+        for (const auto& request : requests) {
+            m_CompleteFileInfos(request.loadInfos);
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_MetadataMutex);
+            m_MetadataResults.insert(m_MetadataResults.end(), requests.begin(), requests.end());
+        }
+        requests.clear();
+    }
+}
+
+void IGFD::FileManager::RequestFilteredFilesMetadata(size_t vStart, size_t vEnd) {
+    const size_t start = (vStart > LAZY_METADATA_PREFETCH_COUNT) ? vStart - LAZY_METADATA_PREFETCH_COUNT : 0U;
+    const size_t end   = (std::min)(vEnd + LAZY_METADATA_PREFETCH_COUNT, m_FilteredFileIndexes.size());
+    std::vector<MetadataRequest> requests;
+    for (size_t idx = start; idx < end; ++idx) {
+        const auto& infos_ptr = m_FileList[m_FilteredFileIndexes[idx]];
+        if (infos_ptr != nullptr && infos_ptr->fileMetadataState == FileInfos::MetadataState::NotLoaded) {
+            infos_ptr->fileMetadataState = FileInfos::MetadataState::Requested;
+            MetadataRequest request;
+            request.targetInfos               = infos_ptr;
+            request.loadInfos                 = FileInfos::create();
+            request.loadInfos->SetFilePath(infos_ptr->GetFilePathPtr());
+            request.loadInfos->fileNameExt    = infos_ptr->fileNameExt;
+            request.loadInfos->fileType       = infos_ptr->fileType;
+            request.loadInfos->fileSize       = infos_ptr->fileSize;
+            request.loadInfos->fileModifTime  = infos_ptr->fileModifTime;
+            request.loadInfos->fileStatFilled = infos_ptr->fileStatFilled;
+            requests.push_back(request);
+        }
+    }
+    if (requests.empty()) {
+        return;
+    }
+    if (m_MetadataThread == nullptr) {
+        m_MetadataThreadStop = false;
+        m_MetadataThread     = std::shared_ptr<std::thread>(new std::thread(&IGFD::FileManager::m_ThreadMetadataFunc, this), [this](std::thread* obj_ptr) {
+            {
+                std::lock_guard<std::mutex> lock(m_MetadataMutex);
+                m_MetadataThreadStop = true;
+            }
+            m_MetadataCondition.notify_one();
+            if (obj_ptr != nullptr) {
+                obj_ptr->join();
+                delete obj_ptr;
+            }
+        });
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_MetadataMutex);
+        m_MetadataRequests.insert(m_MetadataRequests.end(), requests.begin(), requests.end());
+    }
+    m_MetadataCondition.notify_one();
 }
 
-bool IGFD::FileManager::m_CompleteFileInfosWithUserFileAttirbutes(const FileDialogInternal& vFileDialogInternal, const std::shared_ptr<FileInfos>& vInfos) {
-    if (vFileDialogInternal.getDialogConfig().userFileAttributes != nullptr) {
-        if (!vFileDialogInternal.getDialogConfig().userFileAttributes(vInfos.get(), vFileDialogInternal.getDialogConfig().userDatas)) {
-            return false;  // the file will be ignored, so not added to the file list, so not displayed
-        } else {
-            if (!vInfos->fileType.isDir()) {
-                vInfos->formatedFileSize = IGFD::Utils::FormatFileSize(vInfos->fileSize);
+void IGFD::FileManager::ManageLazyMetadata() {
+    if (m_MetadataThread == nullptr) {
+        return;
+    }
+    std::vector<MetadataRequest> results;
+    {
+        std::lock_guard<std::mutex> lock(m_MetadataMutex);
+        results.swap(m_MetadataResults);
+    }
+    for (const auto& result : results) {
+        auto infos_ptr = result.targetInfos.lock();
+        if (infos_ptr != nullptr && infos_ptr->fileMetadataState == FileInfos::MetadataState::Requested) {  // else expired or already loaded by m_LoadFilesMetadata
+            // a size or a date not null before the loading was set by the userFileAttributes callback, so is kept
+            if (infos_ptr->fileSize == 0U) {
+                infos_ptr->fileSize = result.loadInfos->fileSize;
+            }
+            if (infos_ptr->fileModifTime == 0) {
+                infos_ptr->fileModifTime = result.loadInfos->fileModifTime;
             }
+            infos_ptr->fileStatFilled    = result.loadInfos->fileStatFilled;
+            infos_ptr->fileMetadataState = FileInfos::MetadataState::Loaded;
         }
     }
-    return true; // file will be added to file list, so displayed
 }
 
-void IGFD::FileManager::ClearFileLists() {
-    m_FilteredFileList.clear();
-    m_FileList.clear();
+// needed before a sort by size or date, so blocking, but done in parallel according to FileDialogConfig::countScanThreads
+void IGFD::FileManager::m_LoadFilesMetadata(const FileDialogInternal& vFileDialogInternal, const std::vector<std::shared_ptr<FileInfos> >& vFileInfosList) {
+    std::vector<std::shared_ptr<FileInfos> > not_loaded_files;
+    for (const auto& infos_ptr : vFileInfosList) {
+        if (infos_ptr != nullptr && infos_ptr->fileMetadataState != FileInfos::MetadataState::Loaded) {
+            not_loaded_files.push_back(infos_ptr);
+        }
+    }
+    const auto threads_count = (size_t)(std::max)(0, vFileDialogInternal.getDialogConfig().countScanThreads);
+    IGFD::Utils::ParallelFor(not_loaded_files.size(), threads_count, PARALLEL_SCAN_MIN_CHUNK_SIZE, [&not_loaded_files](size_t vStart, size_t vEnd) {
+        for (size_t idx = vStart; idx < vEnd; ++idx) {
+            auto& infos          = *not_loaded_files[idx];
+            const auto user_size = infos.fileSize;  // like ManageLazyMetadata, kept if set by the userFileAttributes callback
+            const auto user_time = infos.fileModifTime;
+            m_CompleteFileInfos(not_loaded_files[idx]);
+            if (user_size != 0U) {
+                infos.fileSize = user_size;
+            }
+            if (user_time != 0) {
+                infos.fileModifTime = user_time;
+            }
+            infos.fileMetadataState = FileInfos::MetadataState::Loaded;
+        }
+    });
 }
 
-void IGFD::FileManager::ClearPathLists() {
-    m_FilteredPathList.clear();
-    m_PathList.clear();
+std::string IGFD::FileManager::m_GetListingSignature(const FileDialogInternal& vFileDialogInternal) {
+    const auto& filterManager = vFileDialogInternal.filterManager;
+    const auto flags          = vFileDialogInternal.getDialogConfig().flags &  //
+                       (ImGuiFileDialogFlags_CaseInsensitiveExtentionFiltering | ImGuiFileDialogFlags_LazyMetadata);
+    return filterManager.dLGFilters + '\n' + std::to_string(flags);  // the files of all the filters, and the hidden files, are listed
 }
 
-void IGFD::FileManager::m_AddFile(const FileDialogInternal& vFileDialogInternal, const std::string& vPath, const std::string& vFileName, const FileType& vFileType) {
-    auto infos_ptr = FileInfos::create();
-
-    infos_ptr->filePath              = vPath;
-    infos_ptr->fileNameExt           = vFileName;
-    infos_ptr->fileNameExt_optimized = Utils::LowerCaseString(infos_ptr->fileNameExt);
-    infos_ptr->fileType              = vFileType;
-
-    if (infos_ptr->fileNameExt.empty() || (infos_ptr->fileNameExt == "." && !vFileDialogInternal.filterManager.dLGFilters.empty())) {  // filename empty or filename is the current dir '.' //-V807
-        return;
+bool IGFD::FileManager::m_PrepareCachedListing(const FileDialogInternal& vFileDialogInternal, const std::string& vPath, CachedListing& vOutListing) {
+    if (vFileDialogInternal.getDialogConfig().countCachedListings <= 0) {
+        return false;
     }
-
-    if (infos_ptr->fileNameExt != ".." && (vFileDialogInternal.getDialogConfig().flags & ImGuiFileDialogFlags_DontShowHiddenFiles) && infos_ptr->fileNameExt[0] == '.') {  // dont show hidden files
-        if (!vFileDialogInternal.filterManager.dLGFilters.empty() || (vFileDialogInternal.filterManager.dLGFilters.empty() && infos_ptr->fileNameExt != ".")) {            // except "." if in directory mode //-V728
-            return;
-        }
+    if (!m_FileSystemPtr->GetDirectoryTimes(vPath, vOutListing.dirModifTime, vOutListing.dirChangeTime)) {
+        return false;
     }
+    vOutListing.signature = m_GetListingSignature(vFileDialogInternal);
+    return true;
+}
 
-    if (infos_ptr->FinalizeFileTypeParsing(vFileDialogInternal.filterManager.GetSelectedFilter().count_dots)) {
-        if (!vFileDialogInternal.filterManager.IsCoveredByFilters(*infos_ptr.get(),  //
-                                                                  (vFileDialogInternal.getDialogConfig().flags & ImGuiFileDialogFlags_CaseInsensitiveExtentionFiltering) != 0)) {
-            return;
+bool IGFD::FileManager::m_RestoreCachedListing(const std::string& vPath, const CachedListing& vListing) {
+    auto it = m_ListingCacheIndex.find(vPath);
+    if (it != m_ListingCacheIndex.end()) {
+        const auto& cached = it->second->second;
+        if (cached.signature == vListing.signature && cached.dirModifTime == vListing.dirModifTime && cached.dirChangeTime == vListing.dirChangeTime) {
+            m_ListingCache.splice(m_ListingCache.begin(), m_ListingCache, it->second);  // most recently used
+            m_FileList = cached.files;
+            for (const auto& infos_ptr : m_FileList) {
+                if (infos_ptr->fileMetadataState == FileInfos::MetadataState::Requested) {
+                    infos_ptr->fileMetadataState = FileInfos::MetadataState::NotLoaded;  // the requests was cleared with the file lists
+                }
+#ifdef USE_THUMBNAILS
+                if (infos_ptr->thumbnailInfo.isReadyToDisplay) {  // the textures was destroyed when the directory was left
+                    infos_ptr->thumbnailInfo.isReadyToDisplay  = 0;
+                    infos_ptr->thumbnailInfo.isLoadingOrLoaded = 0;
+                    infos_ptr->thumbnailInfo.textureID         = nullptr;
+                }
+#endif  // USE_THUMBNAILS
+            }
+            ++m_ListingCacheStats.countHits;
+            return true;
         }
+        // outdated or built with other filters
+        m_ListingCacheStats.countBytes -= cached.countBytes;
+        m_ListingCache.erase(it->second);
+        m_ListingCacheIndex.erase(it);
+        m_ListingCacheStats.countListings = m_ListingCache.size();
     }
+    ++m_ListingCacheStats.countMisses;
+    return false;
+}
 
-    vFileDialogInternal.filterManager.FillFileStyle(infos_ptr);
-
-    m_CompleteFileInfos(infos_ptr);
-
-    if (m_CompleteFileInfosWithUserFileAttirbutes(vFileDialogInternal, infos_ptr)) {
-        m_FileList.push_back(infos_ptr);
+void IGFD::FileManager::m_StoreCachedListing(const FileDialogInternal& vFileDialogInternal, const std::string& vPath, CachedListing& vInOutListing) {
+    vInOutListing.files      = m_FileList;
+    vInOutListing.countBytes = sizeof(CachedListing) + vPath.size() + vInOutListing.signature.size();
+    for (const auto& infos_ptr : m_FileList) {  // approximation, the capacity of the strings is not known with the small string optimization
+        vInOutListing.countBytes += sizeof(FileInfos) + sizeof(std::shared_ptr<FileInfos>) + infos_ptr->fileNameExt.size() * 2U;
+    }
+    if (vInOutListing.countBytes > LISTING_CACHE_MAX_BYTES) {
+        return;  // too big, would evict all the others
+    }
+    auto it = m_ListingCacheIndex.find(vPath);
+    if (it != m_ListingCacheIndex.end()) {
+        m_ListingCacheStats.countBytes -= it->second->second.countBytes;
+        m_ListingCache.erase(it->second);
+        m_ListingCacheIndex.erase(it);
     }
+    m_ListingCacheStats.countBytes += vInOutListing.countBytes;
+    m_ListingCache.emplace_front(vPath, std::move(vInOutListing));
+    m_ListingCacheIndex[vPath] = m_ListingCache.begin();
+    const auto max_count = (size_t)vFileDialogInternal.getDialogConfig().countCachedListings;
+    while (m_ListingCache.size() > max_count || m_ListingCacheStats.countBytes > LISTING_CACHE_MAX_BYTES) {  // evict the least recently used
+        m_ListingCacheStats.countBytes -= m_ListingCache.back().second.countBytes;
+        m_ListingCacheIndex.erase(m_ListingCache.back().first);
+        m_ListingCache.pop_back();
+    }
+    m_ListingCacheStats.countListings = m_ListingCache.size();
 }
 
-void IGFD::FileManager::m_AddPath(const FileDialogInternal& vFileDialogInternal, const std::string& vPath, const std::string& vFileName, const FileType& vFileType) {
-    if (!vFileType.isDir()) return;
-
-    auto infos_ptr = FileInfos::create();
+void IGFD::FileManager::ClearListingCache() {
+    m_ListingCache.clear();
+    m_ListingCacheIndex.clear();
+    m_ListingCacheStats.countListings = 0U;
+    m_ListingCacheStats.countBytes    = 0U;
+}
 
-    infos_ptr->filePath              = vPath;
-    infos_ptr->fileNameExt           = vFileName;
-    infos_ptr->fileNameExt_optimized = Utils::LowerCaseString(infos_ptr->fileNameExt);
-    infos_ptr->fileType              = vFileType;
+const IGFD::FileManager::ListingCacheStats& IGFD::FileManager::GetListingCacheStats() const {
+    return m_ListingCacheStats;
+}
 
-    if (infos_ptr->fileNameExt.empty() || (infos_ptr->fileNameExt == "." && !vFileDialogInternal.filterManager.dLGFilters.empty())) {  // filename empty or filename is the current dir '.' //-V807
+void IGFD::FileManager::m_StartDirectoryWatch(const std::string& vPath) {
+#ifdef _IGFD_INOTIFY_
+    m_StopDirectoryWatch();
+    m_WatchFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_WatchFd < 0) {
         return;
     }
-
-    if (infos_ptr->fileNameExt != ".." && (vFileDialogInternal.getDialogConfig().flags & ImGuiFileDialogFlags_DontShowHiddenFiles) && infos_ptr->fileNameExt[0] == '.') {           // dont show hidden files
-        if (!vFileDialogInternal.filterManager.dLGFilters.empty() || (vFileDialogInternal.filterManager.dLGFilters.empty() && infos_ptr->fileNameExt != ".")) {  // except "." if in directory mode //-V728
-            return;
+    const uint32_t mask = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_CLOSE_WRITE | IN_ATTRIB | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+    if (inotify_add_watch(m_WatchFd, vPath.c_str(), mask) < 0) {
+        m_StopDirectoryWatch();
+        return;
+    }
+    m_WatchedPath = vPath;
+    m_WatchBuffer.resize(DIRECTORY_WATCH_BUFFER_SIZE);  // kept between the watches, the new ones don't allocate
+#else   // _IGFD_INOTIFY_
+    (void)vPath;
+#endif  // _IGFD_INOTIFY_
+}
+
+void IGFD::FileManager::m_StopDirectoryWatch() {
+#ifdef _IGFD_INOTIFY_
+    if (m_WatchFd >= 0) {
+        (void)close(m_WatchFd);  // remove the watch too
+        m_WatchFd = -1;
+    }
+    m_WatchedPath.clear();
+#endif  // _IGFD_INOTIFY_
+}
+
+// the events are coalesced by file name, then each changed file is stat once :
+// removed from the file list if not existing anymore, added or updated else
+void IGFD::FileManager::ManageDirectoryWatch(const FileDialogInternal& vFileDialogInternal) {
+#ifdef _IGFD_INOTIFY_
+    if (m_WatchFd < 0 || m_ScanThread != nullptr) {
+        return;  // the events are kept by the kernel until the end of the async scan
+    }
+    std::set<std::string> changed_names;
+    bool need_rescan     = false;
+    bool watch_is_closed = false;
+    char* buffer = m_WatchBuffer.data();  // aligned for the events by operator new
+    ssize_t len  = 0;
+    while ((len = read(m_WatchFd, buffer, m_WatchBuffer.size())) > 0) {  // until EAGAIN
+        for (char* ptr = buffer; ptr < buffer + len;) {
+            const auto* event_ptr = reinterpret_cast<const struct inotify_event*>(ptr);
+            if (event_ptr->mask & IN_Q_OVERFLOW) {
+                need_rescan = true;  // some events are lost
+            } else if (event_ptr->mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED)) {
+                watch_is_closed = true;
+            } else if (event_ptr->len > 0U) {
+                changed_names.emplace(event_ptr->name);
+            }
+            ptr += sizeof(struct inotify_event) + event_ptr->len;
         }
     }
-
-    vFileDialogInternal.filterManager.FillFileStyle(infos_ptr);
-
-    m_CompleteFileInfos(infos_ptr);
-
-    if (m_CompleteFileInfosWithUserFileAttirbutes(vFileDialogInternal, infos_ptr)) {
-        m_PathList.push_back(infos_ptr);
+    if (watch_is_closed) {
+        m_StopDirectoryWatch();  // the directory was removed or moved, the file list stay as is
+    } else if (need_rescan) {
+        const std::string path = m_WatchedPath;  // ScanDir will clear m_WatchedPath
+        ScanDir(vFileDialogInternal, path);
+    } else if (!changed_names.empty()) {
+        m_ApplyDirectoryChanges(vFileDialogInternal, changed_names);
     }
+#else   // _IGFD_INOTIFY_
+    (void)vFileDialogInternal;
+#endif  // _IGFD_INOTIFY_
 }
 
-void IGFD::FileManager::ScanDir(const FileDialogInternal& vFileDialogInternal, const std::string& vPath) {
-    std::string path = vPath;
-
-    if (m_CurrentPathDecomposition.empty()) {
-        SetCurrentDir(path);
+void IGFD::FileManager::m_ApplyDirectoryChanges(const FileDialogInternal& vFileDialogInternal, const std::set<std::string>& vChangedNames) {
+#ifdef _IGFD_INOTIFY_
+    // the changed files are removed, and the sorted indexes of the others are remapped to their new place in m_FileList
+    std::vector<uint32_t> new_indexes(m_FileList.size(), UINT32_MAX);
+    size_t count_kept = 0U;
+    for (size_t idx = 0U; idx < m_FileList.size(); ++idx) {
+        const auto& infos_ptr = m_FileList[idx];
+        if (infos_ptr == nullptr || vChangedNames.find(infos_ptr->fileNameExt) == vChangedNames.end()) {
+            new_indexes[idx]         = (uint32_t)count_kept;
+            m_FileList[count_kept++] = infos_ptr;
+        }
     }
-
-    if (!m_CurrentPathDecomposition.empty()) {
-#ifdef _IGFD_WIN_
-        if (path == fsRoot) {
-            path += IGFD::Utils::GetPathSeparator();
+    if (count_kept != m_FileList.size()) {  // the names blobs will be filled again at the next search
+        m_FileNamesBlobPtr     = nullptr;
+        m_FileNamesCaseBlobPtr = nullptr;
+    }
+    m_FileList.resize(count_kept);
+    size_t count_sorted = 0U;
+    for (const auto& idx : m_SortedFileIndexes) {
+        if (new_indexes[idx] != UINT32_MAX) {
+            m_SortedFileIndexes[count_sorted++] = new_indexes[idx];
         }
-#endif  // _IGFD_WIN_
-
-        ClearFileLists();
-
-        const auto& files = m_FileSystemPtr->ScanDirectory(path);
-        for (const auto& file : files) {
-            m_AddFile(vFileDialogInternal, path, file.fileNameExt, file.fileType);
+    }
+    m_SortedFileIndexes.resize(count_sorted);
+    const size_t sorted_count = m_FileList.size();
+    const auto path_ptr       = std::make_shared<const std::string>(m_WatchedPath);
+    for (const auto& name : vChangedNames) {
+        const std::string file_path_name = m_WatchedPath + IGFD::Utils::GetPathSeparator() + name;
+        struct stat statInfos = {};
+        if (lstat(file_path_name.c_str(), &statInfos)) {
+            continue;  // removed
+        }
+        DirectoryEntry scanned_file;
+        scanned_file.fileNameExt = name;
+        if (S_ISLNK(statInfos.st_mode)) {
+            scanned_file.fileType.SetSymLink(true);
+            scanned_file.fileType.SetContent(IGFD::FileType::ContentType::LinkToUnknown);
+            if (stat(file_path_name.c_str(), &statInfos)) {
+                statInfos.st_mode = 0;  // broken link
+            }
         }
-
-        m_SortFields(vFileDialogInternal, m_FileList, m_FilteredFileList);
+        if (S_ISDIR(statInfos.st_mode)) {
+            scanned_file.fileType.SetContent(IGFD::FileType::ContentType::Directory);
+        } else if (S_ISREG(statInfos.st_mode)) {
+            scanned_file.fileType.SetContent(IGFD::FileType::ContentType::File);
+        }
+        if (!scanned_file.fileType.isValid()) {
+            continue;  // like the scan, the devices, pipes, etc.. are not listed
+        }
+        if (statInfos.st_mode != 0) {
+            if (!scanned_file.fileType.isDir()) {
+                scanned_file.fileSize = (size_t)statInfos.st_size;
+            }
+            scanned_file.fileModifTime  = (int64_t)statInfos.st_mtime;
+            scanned_file.fileStatFilled = true;
+        }
+        m_AddFile(vFileDialogInternal, path_ptr, scanned_file);
     }
+    if (m_FileList.size() > sorted_count) {  // only the added files are sorted, then merged with the others
+        m_SortFields(vFileDialogInternal, m_FileList, m_SortedFileIndexes, m_FilteredFileIndexes, sorted_count);
+    } else {
+        m_ApplyFilteringOnFileList(vFileDialogInternal, m_FileList, m_SortedFileIndexes, m_FilteredFileIndexes);
+    }
+#else   // _IGFD_INOTIFY_
+    (void)vFileDialogInternal;
+    (void)vChangedNames;
+#endif  // _IGFD_INOTIFY_
+}
+
+bool IGFD::FileManager::IsScanningDirectory() const {
+    return m_ScanThread != nullptr;
+}
+
+size_t IGFD::FileManager::GetScanCountEntries() const {
+    return m_ScanCountEntries;
 }
 
 void IGFD::FileManager::m_ScanDirForPathSelection(const FileDialogInternal& vFileDialogInternal, const std::string& vPath) {
@@ -2066,14 +4496,16 @@ void IGFD::FileManager::m_ScanDirForPathSelection(const FileDialogInternal& vFil
 
         ClearPathLists();
 
-        const auto& files = m_FileSystemPtr->ScanDirectory(path);
-        for (const auto& file : files) {
-            if (file.fileType.isDir()) {
-                m_AddPath(vFileDialogInternal, path, file.fileNameExt, file.fileType);
+        // only the directories are listed, so they will be stat by m_AddPath, not all the entries
+        const auto path_ptr = std::make_shared<const std::string>(path);  // shared by all the directories
+        m_FileSystemPtr->VisitDirectory(path, false, [this, &vFileDialogInternal, &path_ptr](const DirectoryEntry& vEntry) {
+            if (vEntry.fileType.isDir()) {
+                m_AddPath(vFileDialogInternal, path_ptr, vEntry);
             }
-        }
+            return true;
+        });
 
-        m_SortFields(vFileDialogInternal, m_PathList, m_FilteredPathList);
+        m_SortFields(vFileDialogInternal, m_PathList, m_SortedPathIndexes, m_FilteredPathIndexes);
     }
 }
 
@@ -2091,7 +4523,7 @@ bool IGFD::FileManager::GetDevices() {
         m_CurrentPathDecomposition.clear();
         ClearFileLists();
         for (auto& drive : devices) {
-            auto info_ptr                   = FileInfos::create();
+            auto info_ptr                   = FileInfos::create(m_FileInfosStorePtr);
             info_ptr->fileNameExt       = drive.first;
             info_ptr->fileNameExt_optimized = Utils::LowerCaseString(drive.first);
             info_ptr->deviceInfos           = drive.second;
@@ -2125,34 +4557,36 @@ size_t IGFD::FileManager::GetFullFileListSize() const {
     return m_FileList.size();
 }
 
+// in the sorting order, or in the scan order during an async scan
 std::shared_ptr<IGFD::FileInfos> IGFD::FileManager::GetFullFileAt(size_t vIdx) {
+    if (m_SortedFileIndexes.size() == m_FileList.size() && vIdx < m_SortedFileIndexes.size()) return m_FileList[m_SortedFileIndexes[vIdx]];
     if (vIdx < m_FileList.size()) return m_FileList[vIdx];
     return nullptr;
 }
 
 bool IGFD::FileManager::IsFilteredListEmpty() const {
-    return m_FilteredFileList.empty();
+    return m_FilteredFileIndexes.empty();
 }
 
 bool IGFD::FileManager::IsPathFilteredListEmpty() const {
-    return m_FilteredPathList.empty();
+    return m_FilteredPathIndexes.empty();
 }
 
 size_t IGFD::FileManager::GetFilteredListSize() const {
-    return m_FilteredFileList.size();
+    return m_FilteredFileIndexes.size();
 }
 
 size_t IGFD::FileManager::GetPathFilteredListSize() const {
-    return m_FilteredPathList.size();
+    return m_FilteredPathIndexes.size();
 }
 
 std::shared_ptr<IGFD::FileInfos> IGFD::FileManager::GetFilteredFileAt(size_t vIdx) {
-    if (vIdx < m_FilteredFileList.size()) return m_FilteredFileList[vIdx];
+    if (vIdx < m_FilteredFileIndexes.size()) return m_FileList[m_FilteredFileIndexes[vIdx]];
     return nullptr;
 }
 
 std::shared_ptr<IGFD::FileInfos> IGFD::FileManager::GetFilteredPathAt(size_t vIdx) {
-    if (vIdx < m_FilteredPathList.size()) return m_FilteredPathList[vIdx];
+    if (vIdx < m_FilteredPathIndexes.size()) return m_PathList[m_FilteredPathIndexes[vIdx]];
     return nullptr;
 }
 
@@ -2178,19 +4612,553 @@ void IGFD::FileManager::ClearAll() {
     ClearPathLists();
 }
 void IGFD::FileManager::ApplyFilteringOnFileList(const FileDialogInternal& vFileDialogInternal) {
-    m_ApplyFilteringOnFileList(vFileDialogInternal, m_FileList, m_FilteredFileList);
+    m_ApplyFilteringOnFileList(vFileDialogInternal, m_FileList, m_SortedFileIndexes, m_FilteredFileIndexes);
+}
+
+// a file matching a search tag match also all the tags contained in it (SearchForTag is a substring search)
+// so when the new tag contain the previous one, only the previous result is filtered,
+// and when a previous tag come back (backspace), his result is restored without any filtering.
+// with ImGuiFileDialogFlags_AsyncSearch, the search of many files run in a thread, and the file list show the previous results until the first found files
+void IGFD::FileManager::ApplySearchOnFileList(const FileDialogInternal& vFileDialogInternal) {
+    m_StopAsyncSearch();  // the running search is for a previous tag
+    if (IsScanningDirectory()) {  // the file list is growing, the previous results are incomplete
+        ApplyFilteringOnFileList(vFileDialogInternal);
+        return;
+    }
+    const auto& search_tag  = vFileDialogInternal.searchManager.searchTag;
+    const bool fuzzy_search = (vFileDialogInternal.getDialogConfig().flags & ImGuiFileDialogFlags_FuzzySearch);
+    while (!m_SearchStates.empty() && search_tag.find(m_SearchStates.back().searchTag) == std::string::npos) {
+        m_SearchStates.pop_back();  // not refined by the new tag
+    }
+    if (!m_SearchStates.empty() && m_SearchStates.back().searchTag == search_tag) {  // backspace, or same tag
+        m_FilteredFileIndexes   = m_SearchStates.back().filteredIndexes;
+        m_FuzzyFoundFileIndexes = m_SearchStates.back().foundIndexes;
+        return;
+    }
+    if ((vFileDialogInternal.getDialogConfig().flags & ImGuiFileDialogFlags_AsyncSearch) && !search_tag.empty()) {
+        std::vector<uint32_t> candidate_indexes;  // in the sorting order
+        if (!m_SearchStates.empty()) {
+            const auto& previous_state = m_SearchStates.back();
+            if (previous_state.filteredIndexes.size() >= ASYNC_SEARCH_MIN_FILES_COUNT) {
+                candidate_indexes = previous_state.foundIndexes.empty() ? previous_state.filteredIndexes : previous_state.foundIndexes;
+            }
+        } else if (m_FileList.size() >= ASYNC_SEARCH_MIN_FILES_COUNT) {
+            const auto is_candidate = [this, &vFileDialogInternal](size_t vIdx) -> bool {  //
+                return m_IsFileListed(vFileDialogInternal, m_FileList[vIdx]);
+            };
+            for (const auto& idx : m_SortedFileIndexes) {
+                if (is_candidate(idx)) {
+                    candidate_indexes.push_back(idx);
+                }
+            }
+            for (size_t idx = m_SortedFileIndexes.size(); idx < m_FileList.size(); ++idx) {
+                if (is_candidate(idx)) {
+                    candidate_indexes.push_back((uint32_t)idx);
+                }
+            }
+        }
+        if (candidate_indexes.size() >= ASYNC_SEARCH_MIN_FILES_COUNT) {
+            m_StartAsyncSearch(search_tag, fuzzy_search, std::move(candidate_indexes));
+            return;
+        }
+    }
+    if (m_SearchStates.empty()) {  // full pass
+        ApplyFilteringOnFileList(vFileDialogInternal);
+    } else {  // refinement
+        const auto& previous_state = m_SearchStates.back();
+        if (fuzzy_search) {
+            // a subsequence of a name contain also the subsequences of the tags contained in it, the candidates are kept in the sorting order
+            const auto& previous_indexes = previous_state.foundIndexes.empty() ? previous_state.filteredIndexes : previous_state.foundIndexes;
+            m_ApplyFuzzySearch(search_tag, previous_indexes, m_FuzzyFoundFileIndexes, m_FilteredFileIndexes);
+        } else {
+            m_FilteredFileIndexes.clear();
+            for (const auto& idx : previous_state.filteredIndexes) {
+                if (m_IsFileShown(vFileDialogInternal, m_FileList[idx])) {
+                    m_FilteredFileIndexes.push_back(idx);
+                }
+            }
+        }
+    }
+    m_PushSearchState(search_tag);
+}
+
+void IGFD::FileManager::m_PushSearchState(const std::string& vSearchTag) {
+    if (m_SearchStates.size() >= SEARCH_STATES_MAX_COUNT) {
+        m_SearchStates.erase(m_SearchStates.begin());  // the oldest, so the largest
+    }
+    SearchState state;
+    state.searchTag       = vSearchTag;
+    state.filteredIndexes = m_FilteredFileIndexes;
+    state.foundIndexes    = m_FuzzyFoundFileIndexes;
+    m_SearchStates.push_back(std::move(state));
+}
+
+void IGFD::FileManager::m_StartAsyncSearch(const std::string& vSearchTag, bool vFuzzySearch, std::vector<uint32_t>&& vCandidateIndexes) {
+    m_StopAsyncSearch();
+    // same blobs as m_SearchInFileNames and m_ApplyFuzzySearch
+    const bool is_lower_case = !vFuzzySearch && (Utils::LowerCaseString(vSearchTag) == vSearchTag);
+    auto& blob_ptr           = is_lower_case ? m_FileNamesBlobPtr : m_FileNamesCaseBlobPtr;
+    M_UpdateNamesBlob(blob_ptr, m_FileList, is_lower_case);
+    m_SearchThreadTag   = vSearchTag;
+    m_SearchIsFuzzy     = vFuzzySearch;
+    m_SearchIsPublished = false;
+    m_SearchIsWorking   = true;
+    m_SearchThread      = std::shared_ptr<std::thread>(new std::thread(&IGFD::FileManager::m_ThreadAsyncSearchFunc, this, vSearchTag, vFuzzySearch,
+                                                                  std::shared_ptr<const NamesBlob>(blob_ptr), std::move(vCandidateIndexes)),
+                                                  [this](std::thread* obj_ptr) {
+                                                      m_SearchIsWorking = false;
+                                                      if (obj_ptr != nullptr) {
+                                                          obj_ptr->join();
+                                                          delete obj_ptr;
+                                                      }
+                                                  });
+}
+
+void IGFD::FileManager::m_StopAsyncSearch() {
+    m_SearchThread.reset();  // will cancel the search and join the thread
+    std::lock_guard<std::mutex> lock(m_SearchMutex);
+    m_SearchBatch.clear();
+    m_SearchRankedBatch.clear();
+    m_SearchIsDone = false;
+}
+
+// the thread only read his blob copy and his candidates, so the file list can change during the search (the results are then cancelled)
+// the found files are published by batches in ManageAsyncSearch, in the sorting order, except for the fuzzy search who need all the scores
+void IGFD::FileManager::m_ThreadAsyncSearchFunc(std::string vSearchTag, bool vFuzzySearch, std::shared_ptr<const NamesBlob> vBlobPtr, std::vector<uint32_t> vCandidateIndexes) {
+    const auto& blob = *vBlobPtr;
+    if (vFuzzySearch) {
+        std::vector<uint32_t> found_indexes;
+        std::vector<uint32_t> ranked_indexes;
+        M_FuzzySearchInNamesBlob(blob, vSearchTag, vCandidateIndexes, found_indexes, ranked_indexes, &m_SearchIsWorking);
+        if (!m_SearchIsWorking) {
+            return;  // cancelled
+        }
+        std::lock_guard<std::mutex> lock(m_SearchMutex);
+        m_SearchBatch.swap(found_indexes);
+        m_SearchRankedBatch.swap(ranked_indexes);
+        m_SearchIsDone = true;
+        return;
+    }
+    std::vector<uint32_t> batch;
+    for (size_t start = 0U; start < vCandidateIndexes.size(); start += ASYNC_SEARCH_BATCH_SIZE) {
+        if (!m_SearchIsWorking) {
+            return;  // cancelled
+        }
+        const size_t end = (std::min)(start + ASYNC_SEARCH_BATCH_SIZE, vCandidateIndexes.size());
+        for (size_t idx = start; idx < end; ++idx) {
+            if (M_IsTagInBlobName(blob, vCandidateIndexes[idx], vSearchTag)) {
+                batch.push_back(vCandidateIndexes[idx]);
+            }
+        }
+        if (!batch.empty()) {
+            std::lock_guard<std::mutex> lock(m_SearchMutex);
+            m_SearchBatch.insert(m_SearchBatch.end(), batch.begin(), batch.end());
+            batch.clear();
+        }
+    }
+    std::lock_guard<std::mutex> lock(m_SearchMutex);
+    m_SearchIsDone = true;
+}
+
+// the previous results are shown until the first found files, then the found files are appended in the sorting order,
+// so the file list never mix the results of two searches
+void IGFD::FileManager::ManageAsyncSearch() {
+    if (m_SearchThread == nullptr) {
+        return;
+    }
+    std::vector<uint32_t> batch;
+    std::vector<uint32_t> ranked_batch;
+    bool is_done = false;
+    {
+        std::lock_guard<std::mutex> lock(m_SearchMutex);
+        batch.swap(m_SearchBatch);
+        ranked_batch.swap(m_SearchRankedBatch);
+        is_done = m_SearchIsDone;
+    }
+    if (m_SearchIsFuzzy) {
+        if (is_done) {  // the ranking need all the scores
+            m_FuzzyFoundFileIndexes.swap(batch);
+            m_FilteredFileIndexes.swap(ranked_batch);
+        }
+    } else if (!batch.empty() || is_done) {
+        if (!m_SearchIsPublished) {
+            m_SearchIsPublished = true;
+            m_FilteredFileIndexes.clear();
+            m_FuzzyFoundFileIndexes.clear();
+        }
+        m_FilteredFileIndexes.insert(m_FilteredFileIndexes.end(), batch.begin(), batch.end());
+    }
+    if (is_done) {
+        m_SearchThread.reset();
+        m_SearchIsDone = false;
+        m_PushSearchState(m_SearchThreadTag);
+    }
+}
+
+bool IGFD::FileManager::IsSearchRunning() const {
+    return m_SearchThread != nullptr;
+}
+
+// the files not yet sorted (after vSortedIndexes, like during an async scan) are gathered after in the scan order
+void IGFD::FileManager::m_ApplyFilteringOnFileList(const FileDialogInternal& vFileDialogInternal, const std::vector<std::shared_ptr<FileInfos> >& vFileInfosList,
+                                                   const std::vector<uint32_t>& vSortedIndexes, std::vector<uint32_t>& vFilteredIndexes) {
+    const auto& search_tag  = vFileDialogInternal.searchManager.searchTag;
+    const bool is_file_list = (&vFilteredIndexes == &m_FilteredFileIndexes);
+    const bool fuzzy_search = is_file_list && !search_tag.empty() && (vFileDialogInternal.getDialogConfig().flags & ImGuiFileDialogFlags_FuzzySearch);
+    std::vector<uint8_t> found_by_tag;  // for the file list, the names are searched in one pass, so the files are not accessed
+    if (is_file_list) {
+        m_StopAsyncSearch();     // his results would be for the previous files or order
+        m_SearchStates.clear();  // the previous search results are no longer valid (new files, new order, new filter, etc..)
+        m_FuzzyFoundFileIndexes.clear();
+        m_FilesCountByFilterIsDirty = true;  // new files
+        if (!search_tag.empty() && !fuzzy_search) {
+            m_SearchInFileNames(search_tag, found_by_tag);
+        }
+    }
+    const auto is_shown = [&](size_t vIdx) -> bool {
+        if (fuzzy_search) return m_IsFileListed(vFileDialogInternal, vFileInfosList[vIdx]);  // candidate
+        if (found_by_tag.empty()) return m_IsFileShown(vFileDialogInternal, vFileInfosList[vIdx]);
+        return found_by_tag[vIdx] != 0U && m_IsFileListed(vFileDialogInternal, vFileInfosList[vIdx]);
+    };
+    vFilteredIndexes.clear();
+    for (const auto& idx : vSortedIndexes) {
+        if (is_shown(idx)) {
+            vFilteredIndexes.push_back(idx);
+        }
+    }
+    for (size_t idx = vSortedIndexes.size(); idx < vFileInfosList.size(); ++idx) {
+        if (is_shown(idx)) {
+            vFilteredIndexes.push_back((uint32_t)idx);
+        }
+    }
+    if (fuzzy_search) {  // the shown files are the candidates of the fuzzy search
+        std::vector<uint32_t> candidate_indexes;
+        candidate_indexes.swap(vFilteredIndexes);
+        m_ApplyFuzzySearch(search_tag, candidate_indexes, m_FuzzyFoundFileIndexes, vFilteredIndexes);
+    }
+}
+
+bool IGFD::FileManager::m_IsFileShown(const FileDialogInternal& vFileDialogInternal, const std::shared_ptr<FileInfos>& vFileInfos) const {
+    if (!vFileInfos.use_count()) return false;
+    const auto& search_tag = vFileDialogInternal.searchManager.searchTag;
+    if (!search_tag.empty() && (vFileDialogInternal.getDialogConfig().flags & ImGuiFileDialogFlags_FuzzySearch)) {
+        if (M_GetFuzzyScore(vFileInfos->fileNameExt.data(), vFileInfos->fileNameExt.size(), search_tag, nullptr) == INT32_MIN) return false;
+    } else if (!vFileInfos->SearchForTag(search_tag))  // if search tag
+        return false;
+    return m_IsFileListed(vFileDialogInternal, vFileInfos);
+}
+
+// except "." (only listed in directory mode) and ".."
+bool IGFD::FileManager::M_IsHiddenFile(const FileInfos& vFileInfos) {
+    return !vFileInfos.fileNameExt.empty() && vFileInfos.fileNameExt[0] == '.' && vFileInfos.fileNameExt != "." && vFileInfos.fileNameExt != "..";
+}
+
+bool IGFD::FileManager::m_IsFileListed(const FileDialogInternal& vFileDialogInternal, const std::shared_ptr<FileInfos>& vFileInfos) const {
+    if (!vFileInfos.use_count()) return false;
+    if (dLGDirectoryMode && !vFileInfos->fileType.isDir()) return false;
+    if ((vFileDialogInternal.getDialogConfig().flags & ImGuiFileDialogFlags_DontShowHiddenFiles) && M_IsHiddenFile(*vFileInfos)) return false;
+    return vFileDialogInternal.filterManager.IsCoveredBySelectedFilter(*vFileInfos,  //
+                                                                       (vFileDialogInternal.getDialogConfig().flags & ImGuiFileDialogFlags_CaseInsensitiveExtentionFiltering) != 0);
+}
+
+// the names of a blob are separated by '\0' and a search tag not contain '\0', so a tag is always found inside a name
+// these functions return the offset of the first tag found between vStart and vEnd, or std::string::npos
+
+#ifndef _IGFD_SIMD_SEARCH_
+
+static size_t findTagScalar(const char* vChars, size_t vStart, size_t vEnd, const char* vTag, size_t vTagSize) {
+    for (size_t pos = vStart; pos + vTagSize <= vEnd;) {
+        const auto* ptr = static_cast<const char*>(memchr(vChars + pos, vTag[0], vEnd - vTagSize + 1U - pos));
+        if (ptr == nullptr) break;
+        pos = (size_t)(ptr - vChars);
+        if (memcmp(ptr + 1, vTag + 1, vTagSize - 1U) == 0) return pos;
+        ++pos;
+    }
+    return std::string::npos;
+}
+
+#else  // _IGFD_SIMD_SEARCH_
+
+static inline uint32_t countTrailingZeros(uint32_t vValue) {
+#ifdef _MSC_VER
+    unsigned long idx = 0;
+    _BitScanForward(&idx, vValue);
+    return (uint32_t)idx;
+#else
+    return (uint32_t)__builtin_ctz(vValue);
+#endif
+}
+
+// the first and the last chars of the tag are compared with 16 positions at once,
+// and only the positions where the both are found are compared with the whole tag
+static size_t findTagSSE2(const char* vChars, size_t vStart, size_t vEnd, const char* vTag, size_t vTagSize) {
+    const __m128i first = _mm_set1_epi8(vTag[0]);
+    const __m128i last  = _mm_set1_epi8(vTag[vTagSize - 1U]);
+    for (size_t pos = vStart; pos + vTagSize <= vEnd; pos += 16U) {
+        const __m128i block_first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(vChars + pos));
+        const __m128i block_last  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(vChars + pos + vTagSize - 1U));
+        uint32_t mask             = (uint32_t)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(block_first, first), _mm_cmpeq_epi8(block_last, last)));
+        while (mask != 0U) {
+            const size_t found = pos + countTrailingZeros(mask);
+            if (found + vTagSize > vEnd) return std::string::npos;
+            if (vTagSize < 3U || memcmp(vChars + found + 1U, vTag + 1, vTagSize - 2U) == 0) return found;
+            mask &= mask - 1U;
+        }
+    }
+    return std::string::npos;
+}
+
+// same as findTagSSE2 with 32 positions at once
+IGFD_TARGET_AVX2 static size_t findTagAVX2(const char* vChars, size_t vStart, size_t vEnd, const char* vTag, size_t vTagSize) {
+    const __m256i first = _mm256_set1_epi8(vTag[0]);
+    const __m256i last  = _mm256_set1_epi8(vTag[vTagSize - 1U]);
+    for (size_t pos = vStart; pos + vTagSize <= vEnd; pos += 32U) {
+        const __m256i block_first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(vChars + pos));
+        const __m256i block_last  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(vChars + pos + vTagSize - 1U));
+        uint32_t mask             = (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(block_first, first), _mm256_cmpeq_epi8(block_last, last)));
+        while (mask != 0U) {
+            const size_t found = pos + countTrailingZeros(mask);
+            if (found + vTagSize > vEnd) return std::string::npos;
+            if (vTagSize < 3U || memcmp(vChars + found + 1U, vTag + 1, vTagSize - 2U) == 0) return found;
+            mask &= mask - 1U;
+        }
+    }
+    return std::string::npos;
+}
+
+static bool isAVX2Supported() {
+#ifdef _MSC_VER
+    int infos[4] = {};
+    __cpuid(infos, 0);
+    if (infos[0] < 7) return false;
+    __cpuid(infos, 1);
+    if ((infos[2] & (1 << 27)) == 0 || (infos[2] & (1 << 28)) == 0) return false;  // osxsave and avx
+    if ((_xgetbv(0) & 6U) != 6U) return false;                                     // the os save the ymm registers
+    __cpuidex(infos, 7, 0);
+    return (infos[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+
+#endif  // _IGFD_SIMD_SEARCH_
+
+static size_t findTag(const char* vChars, size_t vStart, size_t vEnd, const char* vTag, size_t vTagSize) {
+#ifdef _IGFD_SIMD_SEARCH_
+    static const auto s_FindTag = isAVX2Supported() ? findTagAVX2 : findTagSSE2;  // runtime dispatch, once
+    return s_FindTag(vChars, vStart, vEnd, vTag, vTagSize);
+#else
+    return findTagScalar(vChars, vStart, vEnd, vTag, vTagSize);
+#endif
+}
+
+void IGFD::FileManager::M_UpdateNamesBlob(std::shared_ptr<NamesBlob>& vBlobPtr, const std::vector<std::shared_ptr<FileInfos> >& vFileInfosList, bool vLowerCaseNames) {
+    if (vBlobPtr != nullptr && vBlobPtr->offsets.size() == vFileInfosList.size() + 1U) return;  // up to date
+    if (vBlobPtr == nullptr || vBlobPtr->offsets.size() > vFileInfosList.size() + 1U) {
+        vBlobPtr = std::make_shared<NamesBlob>();
+        vBlobPtr->offsets.push_back(0U);
+    } else if (vBlobPtr.use_count() > 1) {
+        vBlobPtr = std::make_shared<NamesBlob>(*vBlobPtr);  // the async search thread read the current one
+    }
+    auto& vBlob = *vBlobPtr;
+    if (vBlob.chars.size() > vBlob.offsets.back()) {
+        vBlob.chars.resize(vBlob.offsets.back());  // remove the padding
+    }
+    for (size_t idx = vBlob.offsets.size() - 1U; idx < vFileInfosList.size(); ++idx) {
+        const auto& infos_ptr = vFileInfosList[idx];
+        if (infos_ptr != nullptr) {
+            vBlob.chars += vLowerCaseNames ? infos_ptr->fileNameExt_optimized : infos_ptr->fileNameExt;
+            if (infos_ptr->fileNameExt_optimized == "..") {
+                vBlob.parentDirIndexes.push_back((uint32_t)idx);
+            }
+        }
+        vBlob.chars.push_back('\0');
+        vBlob.offsets.push_back((uint32_t)vBlob.chars.size());
+    }
+    vBlob.chars.append(32U, '\0');  // the simd loads can read until 31 chars after the end of the last name
+}
+
+void IGFD::FileManager::M_SearchInNamesBlob(const NamesBlob& vBlob, const std::string& vSearchTag, std::vector<uint32_t>& vOutIndexes) {
+    vOutIndexes.clear();
+    if (vSearchTag.empty() || vBlob.offsets.empty()) return;
+    const size_t count = vBlob.offsets.size() - 1U;
+    const size_t end   = vBlob.offsets.back();
+    size_t idx         = 0U;
+    while (idx < count) {
+        const size_t pos = findTag(vBlob.chars.data(), vBlob.offsets[idx], end, vSearchTag.data(), vSearchTag.size());
+        if (pos == std::string::npos) break;
+        idx = (size_t)(std::upper_bound(vBlob.offsets.begin() + (idx + 1U), vBlob.offsets.end(), (uint32_t)pos) - vBlob.offsets.begin()) - 1U;
+        vOutIndexes.push_back((uint32_t)idx);
+        ++idx;  // the search continue at the next name
+    }
+}
+
+bool IGFD::FileManager::M_IsTagInBlobName(const NamesBlob& vBlob, uint32_t vIdx, const std::string& vSearchTag) {
+    const size_t start = vBlob.offsets[vIdx];
+    const size_t end   = vBlob.offsets[vIdx + 1U] - 1U;
+    if (end - start == 2U && vBlob.chars[start] == '.' && vBlob.chars[start + 1U] == '.') return true;  // like SearchForTag, ".." is always found
+    return findTag(vBlob.chars.data(), start, end, vSearchTag.data(), vSearchTag.size()) != std::string::npos;
+}
+
+// SearchForTag search the tag in the lower case name, then in the name.
+// a lower case tag found in a name is also found in his lower case name, and a tag with upper case chars is never found in a lower case name,
+// so the lower case tags are only searched in the lower case names, and the others only in the names
+void IGFD::FileManager::m_SearchInFileNames(const std::string& vSearchTag, std::vector<uint8_t>& vOutFoundByTag) {
+    const bool is_lower_case = (Utils::LowerCaseString(vSearchTag) == vSearchTag);
+    auto& blob_ptr           = is_lower_case ? m_FileNamesBlobPtr : m_FileNamesCaseBlobPtr;
+    M_UpdateNamesBlob(blob_ptr, m_FileList, is_lower_case);
+    const auto& blob = *blob_ptr;
+    std::vector<uint32_t> found_indexes;
+    M_SearchInNamesBlob(blob, vSearchTag, found_indexes);
+    vOutFoundByTag.assign(m_FileList.size(), 0U);
+    for (const auto& idx : found_indexes) {
+        vOutFoundByTag[idx] = 1U;
+    }
+    for (const auto& idx : blob.parentDirIndexes) {
+        vOutFoundByTag[idx] = 1U;
+    }
+}
+
+// like fzf (v1) : the first occurrence of the tag as a subsequence of the name is found, then shortened from his end.
+// each found char score a point, with a bonus at the start of a word, of a camel case hump or of a number, and for the consecutive chars,
+// each char not found between them is a penalty. like the search, a lower case tag is case insensitive
+int32_t IGFD::FileManager::M_GetFuzzyScore(const char* vName, size_t vNameSize, const std::string& vSearchTag, std::vector<size_t>* vOutPositionsPtr) {
+    static constexpr int32_t SCORE_MATCH                 = 16;
+    static constexpr int32_t SCORE_GAP_START             = -3;
+    static constexpr int32_t SCORE_GAP_EXTENSION         = -1;
+    static constexpr int32_t BONUS_BOUNDARY              = SCORE_MATCH / 2;
+    static constexpr int32_t BONUS_NON_WORD              = SCORE_MATCH / 2;
+    static constexpr int32_t BONUS_CAMEL_123             = BONUS_BOUNDARY + SCORE_GAP_EXTENSION;
+    static constexpr int32_t BONUS_CONSECUTIVE           = -(SCORE_GAP_START + SCORE_GAP_EXTENSION);
+    static constexpr int32_t BONUS_FIRST_CHAR_MULTIPLIER = 2;
+    enum CharClass { NON_WORD = 0, LOWER, UPPER, LETTER, NUMBER };
+    if (vOutPositionsPtr != nullptr) {
+        vOutPositionsPtr->clear();
+    }
+    if (vSearchTag.empty()) return 0;
+    if (vNameSize == 2U && vName[0] == '.' && vName[1] == '.') return INT32_MAX;  // like SearchForTag, ".." is always found, and kept first
+    bool is_case_sensitive = false;
+    for (const auto& c : vSearchTag) {
+        is_case_sensitive |= (c >= 'A' && c <= 'Z');
+    }
+    const auto get_char = [is_case_sensitive](char vChar) -> char {  //
+        return (!is_case_sensitive && vChar >= 'A' && vChar <= 'Z') ? (char)(vChar - 'A' + 'a') : vChar;
+    };
+    const auto get_class = [](char vChar) -> CharClass {
+        if (vChar >= 'a' && vChar <= 'z') return LOWER;
+        if (vChar >= 'A' && vChar <= 'Z') return UPPER;
+        if (vChar >= '0' && vChar <= '9') return NUMBER;
+        if ((unsigned char)vChar >= 0x80U) return LETTER;  // utf8
+        return NON_WORD;
+    };
+    const size_t tag_size = vSearchTag.size();
+    size_t tag_idx        = 0U;
+    size_t end            = 0U;
+    for (size_t idx = 0U; idx < vNameSize && tag_idx < tag_size; ++idx) {
+        if (get_char(vName[idx]) == vSearchTag[tag_idx]) {
+            ++tag_idx;
+            end = idx + 1U;
+        }
+    }
+    if (tag_idx < tag_size) return INT32_MIN;
+    size_t start = end;
+    while (tag_idx > 0U) {  // the tag is found backward from the end, for the shortest occurrence
+        --start;
+        if (get_char(vName[start]) == vSearchTag[tag_idx - 1U]) {
+            --tag_idx;
+        }
+    }
+    CharClass prev_class = (start > 0U) ? get_class(vName[start - 1U]) : NON_WORD;
+    int32_t score        = 0;
+    int32_t first_bonus  = 0;
+    size_t consecutive   = 0U;
+    bool in_gap          = false;
+    for (size_t idx = start; idx < end; ++idx) {
+        const CharClass char_class = get_class(vName[idx]);
+        if (tag_idx < tag_size && get_char(vName[idx]) == vSearchTag[tag_idx]) {
+            int32_t bonus = 0;
+            if (prev_class == NON_WORD && char_class != NON_WORD) {
+                bonus = BONUS_BOUNDARY;
+            } else if ((prev_class == LOWER && char_class == UPPER) || (prev_class != NUMBER && char_class == NUMBER)) {
+                bonus = BONUS_CAMEL_123;
+            } else if (char_class == NON_WORD) {
+                bonus = BONUS_NON_WORD;
+            }
+            if (consecutive == 0U) {
+                first_bonus = bonus;
+            } else {  // a consecutive chunk keep the bonus of his first char
+                if (bonus >= BONUS_BOUNDARY && bonus > first_bonus) {
+                    first_bonus = bonus;
+                }
+                bonus = (std::max)((std::max)(bonus, first_bonus), BONUS_CONSECUTIVE);
+            }
+            score += SCORE_MATCH + ((tag_idx == 0U) ? bonus * BONUS_FIRST_CHAR_MULTIPLIER : bonus);
+            if (vOutPositionsPtr != nullptr) {
+                vOutPositionsPtr->push_back(idx);
+            }
+            in_gap = false;
+            ++consecutive;
+            ++tag_idx;
+        } else {
+            score += in_gap ? SCORE_GAP_EXTENSION : SCORE_GAP_START;
+            in_gap      = true;
+            consecutive = 0U;
+            first_bonus = 0;
+        }
+        prev_class = char_class;
+    }
+    return score;
+}
+
+void IGFD::FileManager::m_ApplyFuzzySearch(const std::string& vSearchTag, const std::vector<uint32_t>& vCandidateIndexes, std::vector<uint32_t>& vOutFoundIndexes,
+                                           std::vector<uint32_t>& vOutFilteredIndexes) {
+    M_UpdateNamesBlob(m_FileNamesCaseBlobPtr, m_FileList, false);
+    M_FuzzySearchInNamesBlob(*m_FileNamesCaseBlobPtr, vSearchTag, vCandidateIndexes, vOutFoundIndexes, vOutFilteredIndexes, nullptr);
+}
+
+// the candidates are scored in parallel chunks, then the found ones are ordered by score (the ties stay in the candidates order)
+void IGFD::FileManager::M_FuzzySearchInNamesBlob(const NamesBlob& vBlob, const std::string& vSearchTag, const std::vector<uint32_t>& vCandidateIndexes,
+                                                 std::vector<uint32_t>& vOutFoundIndexes, std::vector<uint32_t>& vOutFilteredIndexes, const std::atomic<bool>* vIsWorkingPtr) {
+    vOutFoundIndexes.clear();
+    vOutFilteredIndexes.clear();
+    std::vector<int32_t> scores(vCandidateIndexes.size());
+    Utils::ParallelFor(vCandidateIndexes.size(), 0U, FUZZY_SEARCH_MIN_CHUNK_SIZE, [&](size_t vStart, size_t vEnd) {
+        for (size_t idx = vStart; idx < vEnd; ++idx) {
+            if (vIsWorkingPtr != nullptr && (idx & 1023U) == 0U && !*vIsWorkingPtr) {
+                return;  // cancelled
+            }
+            const auto file_idx = vCandidateIndexes[idx];
+            const auto offset   = vBlob.offsets[file_idx];
+            scores[idx]         = M_GetFuzzyScore(vBlob.chars.data() + offset, vBlob.offsets[file_idx + 1U] - offset - 1U, vSearchTag, nullptr);
+        }
+    });
+    if (vIsWorkingPtr != nullptr && !*vIsWorkingPtr) {
+        return;  // cancelled
+    }
+    std::vector<std::pair<int32_t, uint32_t> > found_files;  // <score, index>
+    for (size_t idx = 0U; idx < vCandidateIndexes.size(); ++idx) {
+        if (scores[idx] != INT32_MIN) {
+            found_files.emplace_back(scores[idx], vCandidateIndexes[idx]);
+        }
+    }
+    for (const auto& found : found_files) {
+        vOutFoundIndexes.push_back(found.second);
+    }
+    std::stable_sort(found_files.begin(), found_files.end(), [](const std::pair<int32_t, uint32_t>& a, const std::pair<int32_t, uint32_t>& b) -> bool {  //
+        return a.first > b.first;
+    });
+    for (const auto& found : found_files) {
+        vOutFilteredIndexes.push_back(found.second);
+    }
 }
 
-void IGFD::FileManager::m_ApplyFilteringOnFileList(const FileDialogInternal& vFileDialogInternal, std::vector<std::shared_ptr<FileInfos> >& vFileInfosList, std::vector<std::shared_ptr<FileInfos> >& vFileInfosFilteredList) {
-    vFileInfosFilteredList.clear();
-    for (const auto& file : vFileInfosList) {
-        if (!file.use_count()) continue;
-        bool show = true;
-        if (!file->SearchForTag(vFileDialogInternal.searchManager.searchTag))  // if search tag
-            show = false;
-        if (dLGDirectoryMode && !file->fileType.isDir()) show = false;
-        if (show) vFileInfosFilteredList.push_back(file);
+bool IGFD::FileManager::GetFuzzyMatchPositions(const FileDialogInternal& vFileDialogInternal, const std::shared_ptr<FileInfos>& vInfos, std::vector<size_t>& vOutPositions) const {
+    const auto& search_tag = vFileDialogInternal.searchManager.searchTag;
+    if (vInfos == nullptr || search_tag.empty() || !(vFileDialogInternal.getDialogConfig().flags & ImGuiFileDialogFlags_FuzzySearch)) {
+        return false;
     }
+    M_GetFuzzyScore(vInfos->fileNameExt.data(), vInfos->fileNameExt.size(), search_tag, &vOutPositions);
+    return !vOutPositions.empty();
 }
 
 void IGFD::FileManager::m_CompleteFileInfos(const std::shared_ptr<FileInfos>& vInfos) {
@@ -2212,34 +5180,84 @@ void IGFD::FileManager::m_CompleteFileInfos(const std::shared_ptr<FileInfos>& vI
         // time_t    st_mtime;   /* time of last modification - not sure out of ntfs */
         // time_t    st_ctime;   /* time of last status change - not sure out of ntfs */
 
-        std::string fpn;
+        if (!vInfos->fileStatFilled) {  // not already retrieved by IFileSystem::VisitDirectory
+            std::string fpn;
 
-        // FIXME: so the condition is always true?
-        if (vInfos->fileType.isFile() || vInfos->fileType.isLinkToUnknown() || vInfos->fileType.isDir()) {
-            fpn = vInfos->filePath + IGFD::Utils::GetPathSeparator() + vInfos->fileNameExt;
-        }
+            // FIXME: so the condition is always true?
+            if (vInfos->fileType.isFile() || vInfos->fileType.isLinkToUnknown() || vInfos->fileType.isDir()) {
+                fpn = vInfos->GetFilePath() + IGFD::Utils::GetPathSeparator() + vInfos->fileNameExt;
+            }
 
-        struct stat statInfos = {};
-        char timebuf[100];
-        int result = stat(fpn.c_str(), &statInfos);
-        if (!result) {
-            if (!vInfos->fileType.isDir()) {
-                vInfos->fileSize         = (size_t)statInfos.st_size;
-                vInfos->formatedFileSize = IGFD::Utils::FormatFileSize(vInfos->fileSize);
+            struct stat statInfos = {};
+            int result            = stat(fpn.c_str(), &statInfos);
+            if (!result) {
+                if (!vInfos->fileType.isDir()) {
+                    vInfos->fileSize = (size_t)statInfos.st_size;
+                }
+                vInfos->fileModifTime  = (int64_t)statInfos.st_mtime;
+                vInfos->fileStatFilled = true;
             }
+        }
+    }
+}
 
-            size_t len = 0;
+bool IGFD::FileManager::M_GetLocalTime(int64_t vTime, struct tm& vOutTm) {
+    const time_t time = (time_t)vTime;
 #ifdef _MSC_VER
-            struct tm _tm;
-            errno_t err = localtime_s(&_tm, &statInfos.st_mtime);
-            if (!err) len = strftime(timebuf, 99, DateTimeFormat, &_tm);
+    return (localtime_s(&vOutTm, &time) == 0);
+#elif defined(_IGFD_UNIX_)
+    return (localtime_r(&time, &vOutTm) != nullptr);  // localtime_r because this function can be called by the async scan thread
 #else   // _MSC_VER
-            struct tm* _tm = localtime(&statInfos.st_mtime);
-            if (_tm) len = strftime(timebuf, 99, DateTimeFormat, _tm);
+    struct tm* tm_ptr = localtime(&time);
+    if (tm_ptr != nullptr) {
+        vOutTm = *tm_ptr;
+        return true;
+    }
+    return false;
 #endif  // _MSC_VER
-            if (len) {
-                vInfos->fileModifDate = std::string(timebuf, len);
+}
+
+// the size and the date are formated at the first display of the file, not by the scan
+// the local time is got once per bucket of 15 minutes, since the timezones offsets and changes are almost always on multiples of 15 minutes
+// so the dates of a directory cost only a few localtime calls (who take a lock of the libc each)
+// a bucket with a timezone change inside is not uniform, so his files have their own localtime call
+void IGFD::FileManager::FormatFileInfosMetadata(const std::shared_ptr<FileInfos>& vInfos) {
+    if (vInfos == nullptr || !vInfos->fileStatFilled || vInfos->fileMetadataState != FileInfos::MetadataState::Loaded) {
+        return;
+    }
+    if (vInfos->formatedFileSize.empty() && !vInfos->fileType.isDir()) {
+        vInfos->formatedFileSize = IGFD::Utils::FormatFileSize(vInfos->fileSize);
+    }
+    if (vInfos->fileModifDate.empty()) {
+        static constexpr int64_t BUCKET_SIZE = 15 * 60;
+        const int64_t mtime        = vInfos->fileModifTime;
+        const int64_t bucket_start = mtime - (((mtime % BUCKET_SIZE) + BUCKET_SIZE) % BUCKET_SIZE);
+        auto it                    = m_LocalTimeBuckets.find(bucket_start);
+        if (it == m_LocalTimeBuckets.end()) {
+            if (m_LocalTimeBuckets.size() >= LOCAL_TIME_BUCKETS_MAX_COUNT) {
+                m_LocalTimeBuckets.clear();
             }
+            struct tm start_tm = {};
+            struct tm end_tm   = {};
+            if (!M_GetLocalTime(bucket_start, start_tm) || !M_GetLocalTime(bucket_start + BUCKET_SIZE - 1, end_tm)) {
+                return;
+            }
+            const bool is_uniform = start_tm.tm_sec == 0 && (start_tm.tm_min % 15) == 0 && start_tm.tm_isdst == end_tm.tm_isdst &&  //
+                                    end_tm.tm_hour == start_tm.tm_hour && end_tm.tm_min == start_tm.tm_min + 14 && end_tm.tm_sec == 59;
+            it = m_LocalTimeBuckets.emplace(bucket_start, std::make_pair(start_tm, is_uniform)).first;
+        }
+        struct tm file_tm = it->second.first;
+        if (it->second.second) {
+            const int64_t offset = mtime - bucket_start;  // less than 15 minutes from a quarter, so no carry on the hour
+            file_tm.tm_min += (int)(offset / 60);
+            file_tm.tm_sec += (int)(offset % 60);
+        } else if (!M_GetLocalTime(mtime, file_tm)) {
+            return;
+        }
+        char timebuf[100];
+        const size_t len = strftime(timebuf, 99, DateTimeFormat, &file_tm);
+        if (len) {
+            vInfos->fileModifDate = std::string(timebuf, len);
         }
     }
 }
@@ -2418,7 +5436,8 @@ bool IGFD::FileManager::SelectDirectory(const std::shared_ptr<FileInfos>& vInfos
 
 void IGFD::FileManager::SelectAllFileNames() {
     m_SelectedFileNames.clear();
-    for (const auto& infos_ptr : m_FilteredFileList) {
+    for (const auto& idx : m_FilteredFileIndexes) {
+        const auto& infos_ptr = m_FileList[idx];
         if (infos_ptr != nullptr) {
             m_AddFileNameInSelection(infos_ptr->fileNameExt, true);
         }
@@ -2460,12 +5479,16 @@ void IGFD::FileManager::SelectOrDeselectFileName(const FileDialogInternal& vFile
             bool startMultiSelection = false;
             std::string fileNameToSelect = vInfos->fileNameExt;
             std::string savedLastSelectedFileName;  // for invert selection mode
-            for (const auto& file : m_FileList) {
+            // the fuzzy search order the files by score, so the displayed order is the filtered list
+            const bool fuzzy_search = !vFileDialogInternal.searchManager.searchTag.empty() && (vFileDialogInternal.getDialogConfig().flags & ImGuiFileDialogFlags_FuzzySearch);
+            const size_t count_files = fuzzy_search ? m_FilteredFileIndexes.size() : m_FileList.size();
+            for (size_t idx = 0U; idx < count_files; ++idx) {  // in the displayed order
+                const auto file = fuzzy_search ? GetFilteredFileAt(idx) : GetFullFileAt(idx);
                 if (!file.use_count()) {
                     continue;
                 }
                 bool canTake = true;
-                if (!file->SearchForTag(vFileDialogInternal.searchManager.searchTag))
+                if (!m_IsFileListed(vFileDialogInternal, file) || (!fuzzy_search && !file->SearchForTag(vFileDialogInternal.searchManager.searchTag)))
                     canTake = false;
                 if (canTake) {  // if not filtered, we will take files who are filtered by the dialog
                     if (file->fileNameExt == m_LastSelectedFileName) {
@@ -2720,6 +5743,12 @@ void IGFD::FileDialogInternal::NewFrame() {
     fileManager.devicesClicked = false;
     fileManager.pathClicked = false;
 
+    fileManager.ManageListingStages(*this);
+    fileManager.ManageAsyncScan(*this);
+    fileManager.ManageAsyncSearch();
+    fileManager.ManageLazyMetadata();
+    fileManager.ManageDirectoryWatch(*this);
+
     needToExitDialog = false;
 
 #ifdef USE_DIALOG_EXIT_WITH_KEY
@@ -2824,6 +5853,10 @@ IGFD::FileDialogConfig& IGFD::FileDialogInternal::getDialogConfigRef() {
     return m_DialogConfig;
 }
 
+bool IGFD::FileDialogInternal::IsSearchRunning() const {
+    return fileManager.IsSearchRunning();
+}
+
 IGFD::ThumbnailFeature::ThumbnailFeature() {
 #ifdef USE_THUMBNAILS
     m_DisplayMode = DisplayModeEnum::FILE_LIST;
@@ -2897,7 +5930,7 @@ void IGFD::ThumbnailFeature::m_ThreadThumbnailFileDatasExtractionFunc() {
                 if (file->fileType.isFile()) {  //-V522
                     //|| file->fileExtLevels == ".hdr" => format float so in few times
                     if (file->SearchForExts(".png,.bmp,.tga,.jpg,.jpeg,.gif,.psd,.pic,.ppm,.pgm", true)) {
-                        auto fpn       = file->filePath + IGFD::Utils::GetPathSeparator() + file->fileNameExt;
+                        auto fpn       = file->GetFilePath() + IGFD::Utils::GetPathSeparator() + file->fileNameExt;
                         int w          = 0;
                         int h          = 0;
                         int chans      = 0;
@@ -3805,7 +6838,7 @@ bool IGFD::FileDialog::Display(const std::string& vKey, ImGuiWindowFlags vFlags,
                 fdFilter.SetDefaultFilterIfNotDefined();
 
                 // init list of files
-                if (fdFile.IsFileListEmpty() && !fdFile.showDevices) {
+                if (fdFile.IsFileListEmpty() && !fdFile.showDevices && !fdFile.IsScanningDirectory()) {
                     if (fdFile.dLGpath != ".")                                                      // Removes extension seperator in filename if we don't check
                         IGFD::Utils::ReplaceString(fdFile.dLGDefaultFileName, fdFile.dLGpath, "");  // local path
 
@@ -3896,6 +6929,15 @@ void IGFD::FileDialog::m_DrawHeader() {
     }
 #endif  // USE_THUMBNAILS
 
+    if (m_FileDialogInternal.fileManager.IsScanningDirectory()) {
+        ImGui::Text(scanningDirectoryString, m_FileDialogInternal.fileManager.GetScanCountEntries());
+        ImGui::SameLine();
+    }
+    if (m_FileDialogInternal.IsSearchRunning()) {
+        ImGui::TextUnformatted(searchingString);
+        ImGui::SameLine();
+    }
+
     m_FileDialogInternal.searchManager.DrawSearchBar(m_FileDialogInternal);
 }
 
@@ -4189,6 +7231,24 @@ void IGFD::FileDialog::m_BeginFileColorIconStyle(std::shared_ptr<FileInfos> vFil
     if (*vOutFont) ImGui::PushFont(*vOutFont);
 }
 
+// the found chars are highlighted like a text selection. the positions are bytes, so the whole utf8 char of each one is highlighted
+void IGFD::FileDialog::m_DrawFuzzyMatchPositions(const ImVec2& vTextPos, const std::string& vText, size_t vNameOffset, const std::vector<size_t>& vPositions) {
+    auto* draw_list_ptr     = ImGui::GetWindowDrawList();
+    const ImU32 color       = ImGui::GetColorU32(ImGuiCol_TextSelectedBg);
+    const float line_height = ImGui::GetTextLineHeight();
+    const char* text_ptr    = vText.c_str();
+    for (const auto& pos : vPositions) {
+        size_t start = vNameOffset + pos;
+        size_t end   = start + 1U;
+        if (end > vText.size()) break;
+        while (start > vNameOffset && (vText[start] & 0xC0) == 0x80) --start;  // utf8 continuation byte
+        while (end < vText.size() && (vText[end] & 0xC0) == 0x80) ++end;
+        const float start_x = vTextPos.x + ImGui::CalcTextSize(text_ptr, text_ptr + start).x;
+        const float end_x   = vTextPos.x + ImGui::CalcTextSize(text_ptr, text_ptr + end).x;
+        draw_list_ptr->AddRectFilled(ImVec2(start_x, vTextPos.y), ImVec2(end_x, vTextPos.y + line_height), color);
+    }
+}
+
 void IGFD::FileDialog::m_EndFileColorIconStyle(const bool& vShowColor, ImFont* vFont) {
     if (vFont) ImGui::PopFont();
     if (vShowColor) ImGui::PopStyleColor();
@@ -4303,12 +7363,16 @@ void IGFD::FileDialog::m_DrawFileListView(ImVec2 vSize) {
             int column_id = 0;
             m_FileListClipper.Begin((int)fdi.GetFilteredListSize(), ImGui::GetTextLineHeightWithSpacing());
             while (m_FileListClipper.Step()) {
+                if (m_FileDialogInternal.getDialogConfig().flags & ImGuiFileDialogFlags_LazyMetadata) {
+                    fdi.RequestFilteredFilesMetadata((size_t)(std::max)(0, m_FileListClipper.DisplayStart), (size_t)(std::max)(0, m_FileListClipper.DisplayEnd));
+                }
                 for (int i = m_FileListClipper.DisplayStart; i < m_FileListClipper.DisplayEnd; i++) {
                     if (i < 0) continue;
 
                     auto infos_ptr = fdi.GetFilteredFileAt((size_t)i);
                     if (!infos_ptr.use_count()) continue;
 
+                    fdi.FormatFileInfosMetadata(infos_ptr);  // size and date formated at the first display
                     m_BeginFileColorIconStyle(infos_ptr, _showColor, _str, &_font);
 
                     bool selected = fdi.IsFileNameSelected(infos_ptr->fileNameExt);  // found
@@ -4317,14 +7381,19 @@ void IGFD::FileDialog::m_DrawFileListView(ImVec2 vSize) {
 
                     column_id = 0;
                     if (ImGui::TableNextColumn()) {  // file name
+                        const size_t name_offset = _str.size() - infos_ptr->fileNameExt.size();  // after the icon
                         if (!infos_ptr->deviceInfos.empty()) {
                             _str += " " + infos_ptr->deviceInfos;
                         }
+                        const ImVec2 text_pos = ImGui::GetCursorScreenPos();
                         m_SelectableItem(i, infos_ptr, selected, _str.c_str());
+                        if (fdi.GetFuzzyMatchPositions(m_FileDialogInternal, infos_ptr, m_FuzzyMatchPositions)) {
+                            m_DrawFuzzyMatchPositions(text_pos, _str, name_offset, m_FuzzyMatchPositions);
+                        }
                         m_DisplayFileInfosTooltip(i, column_id++, infos_ptr);
                     }
                     if (ImGui::TableNextColumn()) {  // file type
-                        ImGui::Text("%s", infos_ptr->fileExtLevels[0].c_str());
+                        ImGui::Text("%s", infos_ptr->GetFileExtLevel(0U));
                         m_DisplayFileInfosTooltip(i, column_id++, infos_ptr);
                     }
                     if (ImGui::TableNextColumn()) {  // file size
@@ -4490,12 +7559,16 @@ void IGFD::FileDialog::m_DrawThumbnailsListView(ImVec2 vSize) {
             int column_id = 0;
             m_FileListClipper.Begin((int)fdi.GetFilteredListSize(), itemHeight);
             while (m_FileListClipper.Step()) {
+                if (m_FileDialogInternal.getDialogConfig().flags & ImGuiFileDialogFlags_LazyMetadata) {
+                    fdi.RequestFilteredFilesMetadata((size_t)(std::max)(0, m_FileListClipper.DisplayStart), (size_t)(std::max)(0, m_FileListClipper.DisplayEnd));
+                }
                 for (int i = m_FileListClipper.DisplayStart; i < m_FileListClipper.DisplayEnd; i++) {
                     if (i < 0) continue;
 
                     auto infos_ptr = fdi.GetFilteredFileAt((size_t)i);
                     if (!infos_ptr.use_count()) continue;
 
+                    fdi.FormatFileInfosMetadata(infos_ptr);  // size and date formated at the first display
                     m_BeginFileColorIconStyle(infos_ptr, _showColor, _str, &_font);
 
                     bool selected = fdi.IsFileNameSelected(infos_ptr->fileNameExt);  // found
@@ -4512,7 +7585,7 @@ void IGFD::FileDialog::m_DrawThumbnailsListView(ImVec2 vSize) {
                     }
                     if (ImGui::TableNextColumn()) 
                     {  // file type
-                        ImGui::Text("%s", infos_ptr->fileExtLevels[0].c_str());
+                        ImGui::Text("%s", infos_ptr->GetFileExtLevel(0U));
                         m_DisplayFileInfosTooltip(i, column_id++, infos_ptr);
                     }
                     if (ImGui::TableNextColumn()) {  // file size
@@ -4586,6 +7659,7 @@ void IGFD::FileDialog::m_DrawSidePane(float vHeight) {
 }
 
 void IGFD::FileDialog::Close() {
+    m_FileDialogInternal.fileManager.ClearFileLists();  // will cancel a running async scan
     m_FileDialogInternal.dLGkey.clear();
     m_FileDialogInternal.showDialog = false;
 }
@@ -4645,20 +7719,45 @@ IGFD::UserDatas IGFD::FileDialog::GetUserDatas() const {
     return m_FileDialogInternal.getDialogConfig().userDatas;
 }
 
+const IGFD::FileManager::ListingCacheStats& IGFD::FileDialog::GetListingCacheStats() const {
+    return m_FileDialogInternal.fileManager.GetListingCacheStats();
+}
+
+void IGFD::FileDialog::ClearListingCache() {
+    m_FileDialogInternal.fileManager.ClearListingCache();
+}
+
+ImGuiFileDialogFlags IGFD::FileDialog::GetFlags() const {
+    return m_FileDialogInternal.getDialogConfig().flags;
+}
+
+void IGFD::FileDialog::SetFlags(ImGuiFileDialogFlags vFlags) {
+    // the file list is updated by FileManager::ManageListingStages. a running async scan is not disturbed, since it use a copy of the config
+    m_FileDialogInternal.getDialogConfigRef().flags = vFlags;
+}
+
 bool IGFD::FileDialog::IsOk() const {
     return m_FileDialogInternal.isOk;
 }
 
 void IGFD::FileDialog::SetFileStyle(const IGFD_FileStyleFlags& vFlags, const char* vCriteria, const FileStyle& vInfos) {
     m_FileDialogInternal.filterManager.SetFileStyle(vFlags, vCriteria, vInfos);
+    m_FileDialogInternal.fileManager.ClearListingCache();  // the cached files have the old styles
 }
 
 void IGFD::FileDialog::SetFileStyle(const IGFD_FileStyleFlags& vFlags, const char* vCriteria, const ImVec4& vColor, const std::string& vIcon, ImFont* vFont) {
     m_FileDialogInternal.filterManager.SetFileStyle(vFlags, vCriteria, vColor, vIcon, vFont);
+    m_FileDialogInternal.fileManager.ClearListingCache();  // the cached files have the old styles
+}
+
+void IGFD::FileDialog::SetFileStyle(FileStyle::FileStyleFunctor vFunctor, bool vIsThreadSafe) {
+    m_FileDialogInternal.filterManager.SetFileStyle(vFunctor, vIsThreadSafe);
+    m_FileDialogInternal.fileManager.ClearListingCache();  // the cached files have the old styles
 }
 
-void IGFD::FileDialog::SetFileStyle(FileStyle::FileStyleFunctor vFunctor) {
-    m_FileDialogInternal.filterManager.SetFileStyle(vFunctor);
+void IGFD::FileDialog::SetFileStyleBatch(FileStyle::FileStyleBatchFunctor vFunctor, bool vIsThreadSafe) {
+    m_FileDialogInternal.filterManager.SetFileStyleBatch(vFunctor, vIsThreadSafe);
+    m_FileDialogInternal.fileManager.ClearListingCache();  // the cached files have the old styles
 }
 
 bool IGFD::FileDialog::GetFileStyle(const IGFD_FileStyleFlags& vFlags, const std::string& vCriteria, ImVec4* vOutColor, std::string* vOutIcon, ImFont** vOutFont) {
@@ -4667,6 +7766,7 @@ bool IGFD::FileDialog::GetFileStyle(const IGFD_FileStyleFlags& vFlags, const std
 
 void IGFD::FileDialog::ClearFilesStyle() {
     m_FileDialogInternal.filterManager.ClearFilesStyle();
+    m_FileDialogInternal.fileManager.ClearListingCache();  // the cached files have the old styles
 }
 
 void IGFD::FileDialog::SetLocales(const int& /*vLocaleCategory*/, const std::string& vLocaleBegin, const std::string& vLocaleEnd) {
@@ -4761,6 +7861,9 @@ IGFD_C_API IGFD_FileDialog_Config IGFD_FileDialog_Config_Get() {
     res.sidePane               = nullptr;
     res.sidePaneWidth = 250.0f;     
     res.flags         = ImGuiFileDialogFlags_Default;
+    res.countScanThreads = 1;
+    res.countCachedListings = 0;
+    res.parallelSortThreshold = 0;
     return res;
 }
 
@@ -4827,6 +7930,9 @@ IGFD_C_API void IGFD_OpenDialog(             // open a standard dialog
         config.flags             = vConfig.flags;
         config.sidePane          = vConfig.sidePane;
         config.sidePaneWidth     = vConfig.sidePaneWidth;
+        config.countScanThreads  = vConfig.countScanThreads;
+        config.countCachedListings = vConfig.countCachedListings;
+        config.parallelSortThreshold = vConfig.parallelSortThreshold;
         vContextPtr->OpenDialog(vKey, vTitle, vFilters, config);
     }
 }
@@ -99,6 +99,11 @@ enum ImGuiFileDialogFlags_ {
     ImGuiFileDialogFlags_DisableQuickPathSelection         = (1 << 12),  // disable the quick path selection
     ImGuiFileDialogFlags_ShowDevicesButton                 = (1 << 13),  // show the devices selection button
     ImGuiFileDialogFlags_NaturalSorting                    = (1 << 14),  // enable the antural sorting for filenames and extentions, slower than standard sorting
+    ImGuiFileDialogFlags_AsyncDirectoryScan                = (1 << 15),  // scan the directories in a thread, the dialog stay responsive during the scan of big directories
+    ImGuiFileDialogFlags_LazyMetadata                      = (1 << 16),  // the size and date of the files are loaded in a thread only when displayed, or when sorted by size or date
+    ImGuiFileDialogFlags_WatchDirectory                    = (1 << 17),  // linux only, the files added, removed or renamed in the current directory are updated in the file list
+    ImGuiFileDialogFlags_FuzzySearch                       = (1 << 18),  // the search tag is matched as a subsequence of the names, the found files are ordered by score
+    ImGuiFileDialogFlags_AsyncSearch                       = (1 << 19),  // the search of the big file lists run in a thread, the found files are published while found
 
     // default behavior when no flags is defined. seems to be the more common cases
     ImGuiFileDialogFlags_Default = ImGuiFileDialogFlags_ConfirmOverwrite |  //
@@ -203,8 +208,11 @@ struct IGFD_Thumbnail_Info {
 #include <list>
 #include <regex>
 #include <array>
+#include <ctime>
 #include <mutex>
+#include <atomic>
 #include <condition_variable>
+#include <exception>
 #include <thread>
 #include <cfloat>
 #include <memory>
@@ -310,6 +318,7 @@ public:
 
 class IGFD_API FileInfos;
 class IGFD_API FileDialogInternal;
+struct IGFD_API FileDialogConfig;
 
 class IGFD_API Utils {
 public:
@@ -337,6 +346,10 @@ public:
     static std::string RoundNumber(double vvalue, int n);                                                               // custom rounding number
     static std::string FormatFileSize(size_t vByteSize);                                                                // format file size field
     static bool NaturalCompare(const std::string& vA, const std::string& vB, bool vInsensitiveCase, bool vDescending);  // natural sorting
+    static std::string GetNaturalSortKey(const std::string& vString);                                                   // key for a natural sorting in insensitive case by a comparison of bytes
+    static void ParallelFor(size_t vCount, size_t vThreadsCount, size_t vMinChunkSize,
+                            const std::function<void(size_t, size_t)>& vFunc);  // call vFunc on contiguous ranges [start, end) of [0, vCount), one per thread (0 threads => hardware concurrency)
+                                                                                // by the calling thread and a pool of threads, the first exception of vFunc is rethrown
 
 #ifdef NEED_TO_BE_PUBLIC_FOR_TESTS
 public:
@@ -351,6 +364,8 @@ private:
 class IGFD_API FileStyle {
 public:
     typedef std::function<bool(const FileInfos&, FileStyle&)> FileStyleFunctor;
+    // style many files in one call, vOutStyles have the size of vFiles, the files not styled must keep a nullptr style
+    typedef std::function<void(const std::vector<const FileInfos*>& vFiles, std::vector<std::shared_ptr<FileStyle> >& vOutStyles)> FileStyleBatchFunctor;
 
 public:
     ImVec4 color = ImVec4(0, 0, 0, 0);
@@ -375,6 +390,31 @@ public:
     void DrawSearchBar(FileDialogInternal& vFileDialogInternal);  // draw the search bar
 };
 
+// a filter with '*' or a regex filter, compiled once by FilterInfos::addCollectionFilter
+// the asterisk filters are searched without regex, and the regex filters in a dfa if possible, else with std::regex
+class IGFD_API FilterMatcher {
+private:
+    enum DfaStateFlags_ : uint8_t {
+        DfaStateFlags_AcceptNow   = (1 << 0),  // the regex was found
+        DfaStateFlags_AcceptAtEnd = (1 << 1),  // the regex is found if the text end here
+    };
+
+private:
+    std::vector<std::string> m_Parts;        // the parts between the '*' of an asterisk filter
+    std::vector<uint16_t> m_DfaTransitions;  // the next state for each char, 256 per state. the state 0 is the start
+    std::vector<uint8_t> m_DfaStatesFlags;   // DfaStateFlags_ of each state
+    std::shared_ptr<std::regex> m_RegexPtr;  // if the regex is not supported by the dfa
+    bool m_IsAsteriskFilter = false;
+
+public:
+    static std::shared_ptr<FilterMatcher> createFromAsteriskFilter(const std::string& vFilter);  // nullptr if the filter contain regex chars
+    static std::shared_ptr<FilterMatcher> createFromRegex(const std::string& vRegex);           // throw std::regex_error if not a valid regex
+    bool search(const std::string& vText) const;  // same result as std::regex_search with the regex of the filter
+
+private:
+    bool m_BuildDfa(const std::string& vRegex);
+};
+
 class IGFD_API FilterInfos {
 private:
     // just for return a default const std::string& in getFirstFilter.
@@ -384,9 +424,9 @@ private:
 
 public:
     std::string title;                                // displayed filter.can be different than rela filter
-    SearchableVector<std::string> filters;            // filters
+    SearchableVector<std::string> filters;            // filters, hashed for the search of the ext levels of a file
     SearchableVector<std::string> filters_optimized;  // optimized filters for case insensitive search
-    std::vector<std::regex> filters_regex;            // collection of regex filter type
+    std::vector<std::shared_ptr<FilterMatcher> > filters_matchers;  // collection of regex filter type, and of filters with '*'
     size_t count_dots = 0U;                           // the max count dot the max per filter of all filters
 
 public:
@@ -402,6 +442,26 @@ public:
 };
 
 class IGFD_API FilterManager {
+private:
+    struct FileStyleRule {                  // a file style criteria compiled by SetFileStyle
+        IGFD_FileStyleFlags flags = 0;
+        std::string criteria;
+        std::shared_ptr<std::regex> regexPtr;  // if the criteria contain "(("
+        std::shared_ptr<FileStyle> style;
+    };
+
+    struct FileStyleFunctorInfos {                  // a functor of SetFileStyle or SetFileStyleBatch
+        FileStyle::FileStyleFunctor functor;
+        FileStyle::FileStyleBatchFunctor batchFunctor;
+        bool isThreadSafe = false;                  // can be called from many threads at same time
+    };
+
+    struct ContainedNode {                                // node of the Aho-Corasick automaton of the IGFD_FileStyleByContainedInFullName criterias
+        std::vector<std::pair<char, uint32_t> > children;  // <char, node>
+        uint32_t failure = 0U;                            // node of the longest suffix also in the automaton
+        std::vector<size_t> ruleIndexes;                  // rules of the criterias ending here, or in the failure nodes
+    };
+
 #ifdef NEED_TO_BE_PUBLIC_FOR_TESTS
 public:
 #else
@@ -410,8 +470,29 @@ private:
     std::vector<FilterInfos> m_ParsedFilters;
     std::unordered_map<IGFD_FileStyleFlags, std::unordered_map<std::string, std::shared_ptr<FileStyle> > > m_FilesStyle;  // file infos for file
                                                                                                                           // extention only
-    std::vector<FileStyle::FileStyleFunctor> m_FilesStyleFunctors;                                                        // file style via lambda function
-    FilterInfos m_SelectedFilter;
+    std::vector<FileStyleFunctorInfos> m_FilesStyleFunctors;                                                              // file style via lambda function
+    std::vector<FileStyleRule> m_FileStyleRules;                                        // in the declaration order, who priorize the rules of a same kind
+    // the lookups of m_FileStyleRules, built on the first use after a change of the rules
+    mutable std::unordered_map<std::string, std::vector<size_t> > m_FileStyleRuleIndexesByName;  // rules by full name (by full name or by type with a criteria)
+    mutable std::unordered_map<std::string, std::vector<size_t> > m_FileStyleRuleIndexesByExt;   // rules by extention
+    mutable std::vector<size_t> m_FileStyleRegexRuleIndexes;                                    // rules with a regex criteria
+    mutable std::vector<size_t> m_FileStyleTypeRuleIndexes;                                     // rules by type without criteria
+    mutable std::vector<ContainedNode> m_FileStyleContainedNodes;                               // rules by contained in full name
+    mutable bool m_FilesStyleIsDirty = false;                                                   // the lookups must be built again
+    size_t m_SelectedFilterIndex = SIZE_MAX;                                            // index of the selected filter in m_ParsedFilters
+    std::string m_SelectedFilterTitle;                                                  // for select the same filter when the filters are parsed again
+    size_t m_MaxCountDots = 0U;                                                         // the max count_dots of the parsed filters
+
+private:
+    static bool M_GetCachedParsedFilters(const std::string& vFilters, std::vector<FilterInfos>& vOutParsedFilters);
+    static void M_CacheParsedFilters(const std::string& vFilters, const std::vector<FilterInfos>& vParsedFilters);
+    void m_ParseFiltersString(const std::string& vFilters);  // fill m_ParsedFilters
+    void m_AddFileStyleRule(const IGFD_FileStyleFlags& vFlags, const std::string& vCriteria, const std::shared_ptr<FileStyle>& vStyle);
+    void m_CompileFilesStyleIfNeeded() const;  // build the lookups of m_FileStyleRules if they are dirty
+    void m_CompileFilesStyle() const;          // build the lookups of m_FileStyleRules
+    void m_FillFileStyleByRules(FileInfos& vFileInfos) const;
+    void m_SelectFilter(size_t vFilterIdx);  // select the filter of m_ParsedFilters, SIZE_MAX for none
+    static void M_CallFileStyleFunctor(const FileStyleFunctorInfos& vFunctorInfos, const std::vector<std::shared_ptr<FileInfos> >& vFiles, size_t vStart, size_t vEnd);
 
 public:
     std::string dLGFilters;
@@ -422,15 +503,21 @@ public:
     void ParseFilters(const char* vFilters);                                                               // Parse filter syntax, detect and parse filter collection
     void SetSelectedFilterWithExt(const std::string& vFilter);                                             // Select filter
     bool FillFileStyle(std::shared_ptr<FileInfos> vFileInfos) const;                                       // fill with the good style
+    void FillFilesStyle(const std::vector<std::shared_ptr<FileInfos> >& vFiles, size_t vThreadsCount) const;  // fill many files, the thread safe functors by many threads
     void SetFileStyle(const IGFD_FileStyleFlags& vFlags, const char* vCriteria, const FileStyle& vInfos);  // Set FileStyle
     void SetFileStyle(const IGFD_FileStyleFlags& vFlags, const char* vCriteria, const ImVec4& vColor, const std::string& vIcon,
                       ImFont* vFont);                         // link file style to Color and Icon and Font
-    void SetFileStyle(FileStyle::FileStyleFunctor vFunctor);  // lambda functor for set file style.
+    void SetFileStyle(FileStyle::FileStyleFunctor vFunctor, bool vIsThreadSafe = false);            // lambda functor for set file style.
+    void SetFileStyleBatch(FileStyle::FileStyleBatchFunctor vFunctor, bool vIsThreadSafe = false);  // lambda functor for set the style of many files
     bool GetFileStyle(const IGFD_FileStyleFlags& vFlags, const std::string& vCriteria, ImVec4* vOutColor, std::string* vOutIcon,
                       ImFont** vOutFont);  // Get Color and Icon for Filter
     void ClearFilesStyle();                // clear m_FileStyle
     bool IsCoveredByFilters(const FileInfos& vFileInfos,
                             bool vIsCaseInsensitive) const;            // check if current file extention (vExt) is covered by current filter, or by regex (vNameExt)
+    uint64_t GetCoveringFiltersMask(FileInfos& vFileInfos,
+                                    bool vIsCaseInsensitive) const;  // the bits of the filters covering the file (see FileInfos::filtersMask), will parse the ext levels of the file
+    bool IsCoveredBySelectedFilter(const FileInfos& vFileInfos,
+                                   bool vIsCaseInsensitive) const;  // by the FileInfos::filtersMask of the file, the dirs are always covered
     float GetFilterComboBoxWidth() const;                              // will return the current combo box widget width
     bool DrawFilterComboBox(FileDialogInternal& vFileDialogInternal);  // draw the filter combobox 	// get the current selected filter
     std::string ReplaceExtentionWithCurrentFilterIfNeeded(const std::string& vFileName,
@@ -472,43 +559,135 @@ public:
     bool operator>(const FileType& rhs) const;
 };
 
+// a pool of slots for the FileInfos of a listing, allocated with their shared_ptr control block by blocks of FILE_INFOS_STORE_BLOCK_SIZE bytes
+// the slot of a released FileInfos is reused by the next one (by ex the files created again by the directory watch), so the store don't grow
+// the blocks are released en bloc with the store, so when the listing is replaced and his last FileInfos is released
+// (the FileInfos are kept alive by the file lists, the listing cache or the thumbnails, and keep alive their store)
+class IGFD_API FileInfosStore {
+public:
+    template <typename T>
+    class Allocator {  // allocator for std::allocate_shared
+    public:
+        typedef T value_type;
+        std::shared_ptr<FileInfosStore> storePtr;
+
+    public:
+        explicit Allocator(const std::shared_ptr<FileInfosStore>& vStorePtr) : storePtr(vStorePtr) {}
+        template <typename U>
+        Allocator(const Allocator<U>& vOther) : storePtr(vOther.storePtr) {}
+        T* allocate(size_t vCount) {
+            return static_cast<T*>(storePtr->Allocate(vCount * sizeof(T), alignof(T)));
+        }
+        void deallocate(T* vPtr, size_t vCount) {
+            storePtr->Deallocate(vPtr, vCount * sizeof(T), alignof(T));
+        }
+        template <typename U>
+        bool operator==(const Allocator<U>& vOther) const {
+            return storePtr == vOther.storePtr;
+        }
+        template <typename U>
+        bool operator!=(const Allocator<U>& vOther) const {
+            return storePtr != vOther.storePtr;
+        }
+    };
+
+private:
+    struct FreeSlot {
+        FreeSlot* next = nullptr;
+    };
+
+private:
+    std::mutex m_Mutex;  // the scan threads allocate at same time, the main thread release
+    std::vector<std::unique_ptr<uint8_t[]> > m_Blocks;
+    FreeSlot* m_FreeSlots = nullptr;  // the released slots, reused first
+    size_t m_SlotSize     = 0U;       // given by the first allocation, the others sizes are not stored here
+    size_t m_BlockOffset  = 0U;       // offset of the never used slots in the last block
+    size_t m_CountUsedSlots = 0U;
+
+public:
+    static std::shared_ptr<FileInfosStore> create();
+
+public:
+    void* Allocate(size_t vSize, size_t vAlign);  // thread safe
+    void Deallocate(void* vPtr, size_t vSize, size_t vAlign);  // thread safe
+    size_t GetCountBlocks();                      // count of blocks allocated
+    size_t GetCountUsedSlots();                   // count of slots in use
+};
+
 class IGFD_API FileInfos {
+public:
+    enum class MetadataState {  // size and date loading state (see ImGuiFileDialogFlags_LazyMetadata)
+        Loaded = 0,             // loaded (always the case without lazy metadata)
+        NotLoaded,              // not loaded, will be requested when displayed
+        Requested               // requested to the metadata loader thread
+    };
+    enum class NaturalSortKeyKind : uint8_t {  // the string of naturalSortKey
+        None = 0,                              // no key
+        Name,                                  // key of fileNameExt
+        Ext                                    // key of the ext level 0
+    };
+
 public:
     static std::shared_ptr<FileInfos> create();
+    static std::shared_ptr<FileInfos> create(const std::shared_ptr<FileInfosStore>& vStorePtr);  // allocated in the store of a listing, make_shared if null
+
+private:
+    // the levels of ext are kept as the positions of their dot in fileNameExt, by ex : a.b.c.d, will give the dots of {.b.c.d, .c.d, .d}
+    // 10 level max are sufficient i guess. the ext and file name of a level are given by GetFileExtLevel and GetFileNameLevel
+    std::array<uint16_t, EXT_MAX_LEVEL> m_ExtLevelDotPositions = {};
+    uint8_t m_CountExtLevels = 0U;
+    // the path is the same for all the files of a directory, so shared between them
+    std::shared_ptr<const std::string> m_FilePathPtr = nullptr;
 
 public:
-    // extention of the file, the array is the levels of ext, by ex : .a.b.c, will be save in {.a.b.c, .b.c, .c}
-    // 10 level max are sufficient i guess. the others levels will be checked if countExtDot > 1
-    std::array<std::string, EXT_MAX_LEVEL> fileExtLevels;
-    std::array<std::string, EXT_MAX_LEVEL> fileExtLevels_optimized;  // optimized for search => insensitivecase
-    // same for file name, can be sued in userFileAttributesFun
-    std::array<std::string, EXT_MAX_LEVEL> fileNameLevels;
-    std::array<std::string, EXT_MAX_LEVEL> fileNameLevels_optimized;  // optimized for search => insensitivecase
-    size_t countExtDot = 0U;                                          // count dots in file extention. this count will give the levels in fileExtLevels
+    size_t countExtDot = 0U;                                          // count dots in file extention. this count will give the levels of ext
     FileType fileType;                                                // fileType
-    std::string filePath;                                             // path of the file
-    std::string fileName;                                             // file name only
     std::string fileNameExt;                                          // filename of the file (file name + extention) (but no path)
     std::string fileNameExt_optimized;                                // optimized for search => insensitivecase
+    std::string naturalSortKey;                                       // natural sorting key of the last natural sort (by name or by type), see naturalSortKeyKind
     std::string deviceInfos;                                          // quick infos to display after name for devices
     std::string tooltipMessage;                                       // message to display on the tooltip, is not empty
     int32_t tooltipColumn = -1;                                       // the tooltip will appears only when the mouse is over the tooltipColumn if > -1
     size_t fileSize       = 0U;                                       // for sorting operations
-    std::string formatedFileSize;                                     // file size formated (10 o, 10 ko, 10 mo, 10 go)
-    std::string fileModifDate;                                        // file user defined format of the date (data + time by default)
+    int64_t fileModifTime = 0;                                        // last modification time, in seconds since epoch (like st_mtime)
+    bool fileStatFilled   = false;                                    // fileSize and fileModifTime are filled (by the file system scan), no need to stat the file again
+    uint64_t filtersMask  = 0U;                                       // bit i : the file is covered by the parsed filter i (the filters from the 64th share the last bit)
+    std::string formatedFileSize;                                     // file size formated (10 o, 10 ko, 10 mo, 10 go), at the first display
+    std::string fileModifDate;                                        // file user defined format of the date (data + time by default), at the first display
+    MetadataState fileMetadataState = MetadataState::Loaded;          // fileSize, fileModifTime, formatedFileSize and fileModifDate are loaded or not
+    NaturalSortKeyKind naturalSortKeyKind = NaturalSortKeyKind::None;  // the field of naturalSortKey
     std::shared_ptr<FileStyle> fileStyle = nullptr;                   // style of the file
 #ifdef USE_THUMBNAILS
     IGFD_Thumbnail_Info thumbnailInfo;  // structre for the display for image file tetxure
 #endif                                  // USE_THUMBNAILS
 
 public:
+    const std::string& GetFilePath() const;                                      // path of the file
+    const std::shared_ptr<const std::string>& GetFilePathPtr() const;            // path of the file, shared with the others files of the directory
+    void SetFilePath(const std::string& vFilePath);                              // set the path of the file, not shared
+    void SetFilePath(const std::shared_ptr<const std::string>& vFilePathPtr);    // set the path of the file, shared with the others files of the directory
+    size_t GetCountExtLevels() const;                                            // count of ext levels found by FinalizeFileTypeParsing
+    const char* GetFileExtLevel(size_t vLevel) const;                            // ext of the level, by ex : .b.c.d for the level 0 of a.b.c.d, "" if not existing
+    const char* GetFileExtLevelOptimized(size_t vLevel) const;                   // same in insensitive case (from fileNameExt_optimized)
+    std::string GetFileNameLevel(size_t vLevel) const;                           // file name without the ext of the level, by ex : a for the level 0 of a.b.c.d
+    std::string GetFileNameLevelOptimized(size_t vLevel) const;                  // same in insensitive case
     bool SearchForTag(const std::string& vTag) const;  // will search a tag in fileNameExt and fileNameExt_optimized
     bool SearchForExt(const std::string& vExt, const bool& vIsCaseInsensitive,
                       const size_t& vMaxLevel = EXT_MAX_LEVEL) const;  // will check the fileExtLevels levels for vExt, until vMaxLevel
     bool SearchForExts(const std::string& vComaSepExts, const bool& vIsCaseInsensitive,
                        const size_t& vMaxLevel = EXT_MAX_LEVEL) const;  // will check the fileExtLevels levels for vExts (ext are coma separated), until vMaxLevel
-    bool FinalizeFileTypeParsing(const size_t& vMaxDotToExtract);       // finalize the parsing the file (only a file or link to file. no dir)
+    bool FinalizeFileTypeParsing(const size_t& vMaxDotToExtract);       // finalize the parsing the file (only a file or link to file. no dir), record the dots of the ext levels
+};
+
+// an entry given by the scan of a directory, only what is needed by the FileManager for create his FileInfos
+struct IGFD_API DirectoryEntry {
+    std::string fileNameExt;        // filename of the entry (file name + extention) (but no path)
+    FileType fileType;              // type of the entry
+    size_t fileSize       = 0U;     // size of the file (not needed for directories)
+    int64_t fileModifTime = 0;      // last modification time, in seconds since epoch (like st_mtime)
+    bool fileStatFilled   = false;  // fileSize and fileModifTime are filled, no need to stat the entry again
 };
+typedef std::function<bool(const DirectoryEntry&)> DirectoryEntryVisitor;  // called for each entry of a scanned directory, return false for stop the scan
 
 typedef std::pair<std::string, std::string> PathDisplayedName;
 
@@ -526,9 +705,33 @@ public:
     // extract the component of a file path name, like path, name, ext
     virtual IGFD::Utils::PathStruct ParsePathFileName(const std::string& vPathFileName) = 0;
     // will return a list of files inside a path
+    // the size and the modification time can be filled in the same pass (fileSize, fileModifTime, fileStatFilled = true)
+    // if fileStatFilled is false, the file will be stat by the FileManager
     virtual std::vector<IGFD::FileInfos> ScanDirectory(const std::string& vPath) = 0;
+    // will call vVisitor for each entry inside a path as soon as read, until vVisitor return false. this is what the FileManager use
+    // without vWithStat, the size and the modification time are not needed (ImGuiFileDialogFlags_LazyMetadata), so a stat per entry can be avoided
+    // the entries with fileStatFilled = false will be stat later by the FileManager, only if needed
+    // by default the entries are given by ScanDirectory, override it for stream the entries without this intermediate list
+    virtual void VisitDirectory(const std::string& vPath, bool /*vWithStat*/, const DirectoryEntryVisitor& vVisitor) {
+        DirectoryEntry entry;
+        for (auto& file : ScanDirectory(vPath)) {
+            entry.fileNameExt    = std::move(file.fileNameExt);
+            entry.fileType       = file.fileType;
+            entry.fileSize       = file.fileSize;
+            entry.fileModifTime  = file.fileModifTime;
+            entry.fileStatFilled = file.fileStatFilled;
+            if (!vVisitor(entry)) {
+                break;
+            }
+        }
+    }
     // say if the path is well a directory
     virtual bool IsDirectory(const std::string& vFilePathName) = 0;
+    // return the modification and change times of a directory, who change when an entry is added, removed or renamed
+    // used for validate the directory listings cache (FileDialogConfig::countCachedListings), no cache if return false
+    virtual bool GetDirectoryTimes(const std::string& /*vPath*/, int64_t& /*vOutModifTime*/, int64_t& /*vOutChangeTime*/) {
+        return false;
+    }
     // return a device list (<path, device name>) on windows, but can be used on other platforms for give to the user a list of devices paths.
     virtual std::vector<IGFD::PathDisplayedName> GetDevicesList() = 0;
 };
@@ -544,6 +747,47 @@ public:                            // types
         FIELD_THUMBNAILS,          // sorted by thumbnails (comparaison by width then by height)
     };
 
+    struct ListingCacheStats {     // statistics of the directory listings cache (see FileDialogConfig::countCachedListings)
+        size_t countHits     = 0U;  // count of directories opened from the cache
+        size_t countMisses   = 0U;  // count of directories scanned since not in the cache, or outdated
+        size_t countListings = 0U;  // count of directory listings in the cache
+        size_t countBytes    = 0U;  // estimated memory size of the cached listings
+    };
+
+private:
+    struct CachedListing {                                 // a directory listing, as displayed after the scan
+        std::string signature;                             // the filters and flags used for build the listing
+        int64_t dirModifTime  = 0;                         // modification time of the directory before the scan
+        int64_t dirChangeTime = 0;                         // change time of the directory before the scan
+        size_t countBytes     = 0U;                        // estimated memory size of the listing
+        std::vector<std::shared_ptr<FileInfos> > files;    // the listed files, shared with m_FileList
+    };
+    typedef std::list<std::pair<std::string, CachedListing> > ListingCacheList;  // <path, listing>, most recently used first
+
+    struct MetadataRequest {                   // a size and date loading request, for the lazy metadata loader thread
+        std::weak_ptr<FileInfos> targetInfos;  // the displayed file, only modified by the main thread
+        std::shared_ptr<FileInfos> loadInfos;  // copy of the fields needed for the loading, completed by the loader thread
+    };
+
+    enum ListingStageFlags_ {                 // the stages of the file list to do again, see ManageListingStages
+        ListingStageFlags_None   = 0,
+        ListingStageFlags_Filter = (1 << 0),  // m_FilteredFileIndexes, by the directory mode, the hidden files, the selected filter and the search
+        ListingStageFlags_Sort   = (1 << 1),  // m_SortedFileIndexes, then the filtered files are only gathered in the new order
+        ListingStageFlags_Scan   = (1 << 2),  // m_FileList, by the scan of the directory
+    };
+
+    struct SearchState {                         // a search result, for narrow it when the search tag is refined
+        std::string searchTag;                   // the search tag of this result
+        std::vector<uint32_t> filteredIndexes;   // the filtered indexes of m_FileList for this search tag
+        std::vector<uint32_t> foundIndexes;      // the fuzzy search found files in the sorting order, when filteredIndexes are ordered by score
+    };
+
+    struct NamesBlob {                            // the names of a file list in one contiguous buffer, for search in one pass
+        std::string chars;                        // the names separated by '\0', then a padding of '\0' for the simd loads
+        std::vector<uint32_t> offsets;            // offset in chars of each name, then the end of the last name
+        std::vector<uint32_t> parentDirIndexes;   // indexes of the ".." entries, always found by the search
+    };
+
 #ifdef NEED_TO_BE_PUBLIC_FOR_TESTS
 public:
 #else
@@ -551,16 +795,59 @@ private:
 #endif
     std::string m_CurrentPath;                                    // current path (to be decomposed in m_CurrentPathDecomposition
     std::vector<std::string> m_CurrentPathDecomposition;          // part words
-    std::vector<std::shared_ptr<FileInfos> > m_FileList;          // base container
-    std::vector<std::shared_ptr<FileInfos> > m_FilteredFileList;  // filtered container (search, sorting, etc..)
-    std::vector<std::shared_ptr<FileInfos> > m_PathList;          // base container for path selection
-    std::vector<std::shared_ptr<FileInfos> > m_FilteredPathList;  // filtered container for path selection (search, sorting, etc..)
+    std::vector<std::shared_ptr<FileInfos> > m_FileList;          // base container, in scan order
+    std::vector<uint32_t> m_SortedFileIndexes;                    // indexes of m_FileList in the sorting order
+    std::vector<uint32_t> m_FilteredFileIndexes;                  // indexes of m_FileList filtered (search, sorting, etc..)
+    std::vector<std::shared_ptr<FileInfos> > m_PathList;          // base container for path selection, in scan order
+    std::vector<uint32_t> m_SortedPathIndexes;                    // indexes of m_PathList in the sorting order
+    std::vector<uint32_t> m_FilteredPathIndexes;                  // indexes of m_PathList filtered for path selection (search, sorting, etc..)
+    std::shared_ptr<FileInfosStore> m_FileInfosStorePtr = nullptr;  // store of the FileInfos of m_FileList, replaced with the listing
+    std::shared_ptr<FileInfosStore> m_PathInfosStorePtr = nullptr;  // store of the FileInfos of m_PathList, replaced with the listing
     std::vector<std::string>::iterator m_PopupComposedPath;       // iterator on m_CurrentPathDecomposition for Current Path popup
     std::string m_LastSelectedFileName;                           // for shift multi selection
     std::set<std::string> m_SelectedFileNames;                    // the user selection of FilePathNames
     bool m_CreateDirectoryMode = false;                           // for create directory widget
     std::string m_FileSystemName;
     std::unique_ptr<IFileSystem> m_FileSystemPtr = nullptr;
+    std::mutex m_ScanBatchMutex;                                  // protect the datas shared with the async scan thread
+    std::vector<std::shared_ptr<FileInfos> > m_ScanBatch;         // files scanned by the async scan thread, not yet published in m_FileList
+    bool m_ScanIsDone = false;                                    // the async scan thread have finished his job
+    std::exception_ptr m_ScanExceptionPtr = nullptr;              // thrown by a user callback in the async scan thread, rethrown by ManageAsyncScan
+    std::atomic<bool> m_ScanIsWorking{false};                     // the async scan thread is working, set to false for cancel the scan
+    std::atomic<size_t> m_ScanCountEntries{0U};                   // count of entries processed by the async scan thread
+    std::shared_ptr<std::thread> m_ScanThread = nullptr;          // the async scan thread (the deleter join the thread)
+    std::mutex m_SearchMutex;                                     // protect the datas shared with the async search thread
+    std::vector<uint32_t> m_SearchBatch;                          // files found by the async search thread, not yet published in m_FilteredFileIndexes
+    std::vector<uint32_t> m_SearchRankedBatch;                    // files found by the async fuzzy search thread ordered by score, published at the end
+    bool m_SearchIsDone = false;                                  // the async search thread have finished his job
+    std::atomic<bool> m_SearchIsWorking{false};                   // the async search thread is working, set to false for cancel the search
+    bool m_SearchIsPublished = false;                             // the found files of the async search have replaced the previous results
+    bool m_SearchIsFuzzy = false;                                 // the async search is a fuzzy search, so published only at the end
+    std::string m_SearchThreadTag;                                // the tag searched by the async search thread
+    std::shared_ptr<std::thread> m_SearchThread = nullptr;        // the async search thread (the deleter join the thread)
+    std::mutex m_MetadataMutex;                                   // protect the datas shared with the lazy metadata loader thread
+    std::condition_variable m_MetadataCondition;                  // wake up the lazy metadata loader thread
+    std::vector<MetadataRequest> m_MetadataRequests;              // requests not yet taken by the lazy metadata loader thread
+    std::vector<MetadataRequest> m_MetadataResults;               // requests done by the lazy metadata loader thread, not yet applied
+    bool m_MetadataThreadStop = false;                            // ask to the lazy metadata loader thread to quit
+    std::shared_ptr<std::thread> m_MetadataThread = nullptr;      // the lazy metadata loader thread (the deleter join the thread)
+    ListingCacheList m_ListingCache;                                                       // the cached directory listings, most recently used first
+    std::unordered_map<std::string, ListingCacheList::iterator> m_ListingCacheIndex;       // path => cached listing
+    ListingCacheStats m_ListingCacheStats;                                                 // hits, misses and size of the listings cache
+    std::string m_PendingListingPath;                                                      // path of the async scan, for cache his listing at the end
+    std::vector<size_t> m_FilesCountByFilter;                                              // count of files of m_FileList by bit of FileInfos::filtersMask
+    int m_DirtyListingStages = 0;                                                          // ListingStageFlags_ of the file list to do again
+    ImGuiFileDialogFlags m_ListingFlags = -1;                                              // the flags of the file list stages at the last scan, -1 if no scan
+    bool m_FilesCountByFilterIsDirty = true;                                               // m_FilesCountByFilter must be counted again
+    CachedListing m_PendingListing;                                                        // signature and times of the async scan listing
+    int m_WatchFd = -1;                                                                    // inotify fd watching the current directory (ImGuiFileDialogFlags_WatchDirectory)
+    std::string m_WatchedPath;                                                             // the watched directory
+    std::vector<char> m_WatchBuffer;                                                       // the inotify events read each frame, allocated by the first watch
+    std::unordered_map<int64_t, std::pair<struct tm, bool> > m_LocalTimeBuckets;           // local time of the start of 15 minutes buckets, and if uniform, for format the dates
+    std::vector<SearchState> m_SearchStates;                                               // the previous search results, each tag contained in the next one
+    std::shared_ptr<NamesBlob> m_FileNamesBlobPtr = nullptr;                               // the lower case names of m_FileList, filled at the first search
+    std::shared_ptr<NamesBlob> m_FileNamesCaseBlobPtr = nullptr;                           // the names of m_FileList, filled at the first search with upper case chars
+    std::vector<uint32_t> m_FuzzyFoundFileIndexes;                                         // the fuzzy search found files in the sorting order (m_FilteredFileIndexes are ordered by score)
 
 public:
     bool inputPathActivated                               = false;  // show input for path edition
@@ -597,28 +884,95 @@ public:
 #else
 private:
 #endif
-    static void m_CompleteFileInfos(const std::shared_ptr<FileInfos>& vInfos);                    // set time and date infos of a file (detail view mode)
+    static void m_CompleteFileInfos(const std::shared_ptr<FileInfos>& vInfos);                    // set size and time infos of a file (detail view mode), formated later
     void m_RemoveFileNameInSelection(const std::string& vFileName);                               // selection : remove a file name
     void m_AddFileNameInSelection(const std::string& vFileName, bool vSetLastSelectionFileName);  // selection : add a file name
-    void m_AddFile(const FileDialogInternal& vFileDialogInternal, const std::string& vPath, const std::string& vFileName,
-                   const FileType& vFileType);  // add file called by scandir
-    void m_AddPath(const FileDialogInternal& vFileDialogInternal, const std::string& vPath, const std::string& vFileName,
-                   const FileType& vFileType);  // add file called by scandir
+    std::shared_ptr<FileInfos> m_CreateFileInfos(const FileDialogConfig& vConfig, const FilterManager& vFilterManager, const std::shared_ptr<const std::string>& vPathPtr,
+                                                 const DirectoryEntry& vScannedFile);  // create a file infos, nullptr if the file must not be listed
+    std::shared_ptr<FileInfos> m_PrepareFileInfos(const FileDialogConfig& vConfig, const FilterManager& vFilterManager, const std::shared_ptr<const std::string>& vPathPtr,
+                                                  const DirectoryEntry& vScannedFile, bool vFillStyleAndComplete) const;  // m_CreateFileInfos without the user callbacks, thread safe
+    void m_CreateFilesInfos(const FileDialogConfig& vConfig, const FilterManager& vFilterManager, const std::shared_ptr<const std::string>& vPathPtr,
+                            const std::vector<DirectoryEntry>& vScannedFiles, size_t vThreadsCount,
+                            std::vector<std::shared_ptr<FileInfos> >& vOutFiles);  // m_CreateFileInfos for many files, by stages
+    void m_AddFilesParallel(const FileDialogInternal& vFileDialogInternal, const std::shared_ptr<const std::string>& vPathPtr,
+                            const std::vector<DirectoryEntry>& vScannedFiles);  // add files called by scandir, prepared by many threads
+    void m_AddFile(const FileDialogInternal& vFileDialogInternal, const std::shared_ptr<const std::string>& vPathPtr,
+                   const DirectoryEntry& vScannedFile);  // add file called by scandir
+    void m_StartAsyncScan(const FileDialogInternal& vFileDialogInternal, const std::string& vPath);  // start the async scan thread
+    void m_StopAsyncScan();                                                                          // cancel the async scan thread, and wait for his end
+    void m_ThreadAsyncScanFunc(std::shared_ptr<const FileDialogConfig> vConfigPtr, std::shared_ptr<const FilterManager> vFilterManagerPtr,
+                               std::string vPath);  // the async scan thread, with copies of the config and of the filters taken at the start of the scan
+    void m_VisitDirectory(const FileDialogConfig& vConfig, const std::string& vPath,
+                          const DirectoryEntryVisitor& vVisitor);  // with or without stat, according to the lazy metadata mode
+    static void m_CompleteOrDeferFileInfos(const FileDialogConfig& vConfig, const std::shared_ptr<FileInfos>& vInfos);  // m_CompleteFileInfos, or later if lazy metadata
+    void m_ThreadMetadataFunc();                                                                                    // the lazy metadata loader thread
+    void m_LoadFilesMetadata(const FileDialogInternal& vFileDialogInternal, const std::vector<std::shared_ptr<FileInfos> >& vFileInfosList);  // load now the metadata not loaded
+    static std::string m_GetListingSignature(const FileDialogInternal& vFileDialogInternal);  // the filters and flags who change the content of a listing
+    bool m_PrepareCachedListing(const FileDialogInternal& vFileDialogInternal, const std::string& vPath,
+                                CachedListing& vOutListing);  // fill the signature and the directory times, false if the listing cannot be cached
+    bool m_RestoreCachedListing(const std::string& vPath, const CachedListing& vListing);  // fill m_FileList from the cache if the listing is there and up to date
+    void m_StoreCachedListing(const FileDialogInternal& vFileDialogInternal, const std::string& vPath, CachedListing& vInOutListing);  // put m_FileList in the cache
+    void m_StartDirectoryWatch(const std::string& vPath);  // watch the directory with inotify (linux only)
+    void m_StopDirectoryWatch();                           // stop the directory watch
+    void m_ApplyDirectoryChanges(const FileDialogInternal& vFileDialogInternal,
+                                 const std::set<std::string>& vChangedNames);  // remove, add or update the changed files in the file lists
+    void m_AddPath(const FileDialogInternal& vFileDialogInternal, const std::shared_ptr<const std::string>& vPathPtr,
+                   const DirectoryEntry& vScannedFile);  // add file called by scandir
     void m_ScanDirForPathSelection(const FileDialogInternal& vFileDialogInternal,
                                    const std::string& vPath);  // scan the directory for retrieve the path list
     void m_OpenPathPopup(const FileDialogInternal& vFileDialogInternal,
                          std::vector<std::string>::iterator vPathIter);   // open the popup list of paths
     void m_SetCurrentPath(std::vector<std::string>::iterator vPathIter);  // set the current path, update the path bar
-    void m_ApplyFilteringOnFileList(const FileDialogInternal& vFileDialogInternal, std::vector<std::shared_ptr<FileInfos> >& vFileInfosList, std::vector<std::shared_ptr<FileInfos> >& vFileInfosFilteredList);
-    static bool M_SortStrings(const FileDialogInternal& vFileDialogInternal,             //
-                              const bool vInsensitiveCase, const bool vDescendingOrder,  //
-                              const std::string& vA, const std::string& vB);
-    void m_SortFields(const FileDialogInternal& vFileDialogInternal, std::vector<std::shared_ptr<FileInfos> >& vFileInfosList,
-                      std::vector<std::shared_ptr<FileInfos> >& vFileInfosFilteredList);  // will sort a column
-    bool m_CompleteFileInfosWithUserFileAttirbutes(const FileDialogInternal& vFileDialogInternal, const std::shared_ptr<FileInfos>& vInfos);
+    void m_ApplyFilteringOnFileList(const FileDialogInternal& vFileDialogInternal, const std::vector<std::shared_ptr<FileInfos> >& vFileInfosList,
+                                    const std::vector<uint32_t>& vSortedIndexes, std::vector<uint32_t>& vFilteredIndexes);  // gather the indexes of the shown files
+    bool m_IsFileShown(const FileDialogInternal& vFileDialogInternal, const std::shared_ptr<FileInfos>& vFileInfos) const;  // the file pass the search and m_IsFileListed
+    bool m_IsFileListed(const FileDialogInternal& vFileDialogInternal, const std::shared_ptr<FileInfos>& vFileInfos) const;  // the file pass the directory mode, the hidden files and the selected filter
+    static bool M_IsHiddenFile(const FileInfos& vFileInfos);  // a hidden file for ImGuiFileDialogFlags_DontShowHiddenFiles
+    bool m_UpdateFilesExtLevels(const FileDialogInternal& vFileDialogInternal,
+                                const std::vector<std::shared_ptr<FileInfos> >& vFileInfosList);  // parse the ext levels of the selected filter, true if some have changed
+    void m_SearchInFileNames(const std::string& vSearchTag, std::vector<uint8_t>& vOutFoundByTag);  // like SearchForTag for all the files of m_FileList, 1 per found file
+    static void M_UpdateNamesBlob(std::shared_ptr<NamesBlob>& vBlobPtr, const std::vector<std::shared_ptr<FileInfos> >& vFileInfosList,
+                                  bool vLowerCaseNames);  // append the names of the files not yet in the blob, in a copy if a search thread use it
+    static bool M_IsTagInBlobName(const NamesBlob& vBlob, uint32_t vIdx, const std::string& vSearchTag);  // like SearchForTag for one name of the blob
+    static void M_SearchInNamesBlob(const NamesBlob& vBlob, const std::string& vSearchTag,
+                                    std::vector<uint32_t>& vOutIndexes);  // indexes of the names containing the tag, in one pass
+    void m_ApplyFuzzySearch(const std::string& vSearchTag, const std::vector<uint32_t>& vCandidateIndexes, std::vector<uint32_t>& vOutFoundIndexes,
+                            std::vector<uint32_t>& vOutFilteredIndexes);  // score the candidate files of m_FileList, the found ones in the same order and ordered by score
+    static void M_FuzzySearchInNamesBlob(const NamesBlob& vBlob, const std::string& vSearchTag, const std::vector<uint32_t>& vCandidateIndexes,
+                                         std::vector<uint32_t>& vOutFoundIndexes, std::vector<uint32_t>& vOutFilteredIndexes,
+                                         const std::atomic<bool>* vIsWorkingPtr);  // m_ApplyFuzzySearch in a blob, stopped when *vIsWorkingPtr become false
+    void m_PushSearchState(const std::string& vSearchTag);  // keep the current search result, for the next searches
+    void m_StartAsyncSearch(const std::string& vSearchTag, bool vFuzzySearch, std::vector<uint32_t>&& vCandidateIndexes);  // start the async search thread
+    void m_StopAsyncSearch();                                                                                              // cancel the async search thread, and wait for his end
+    void m_ThreadAsyncSearchFunc(std::string vSearchTag, bool vFuzzySearch, std::shared_ptr<const NamesBlob> vBlobPtr,
+                                 std::vector<uint32_t> vCandidateIndexes);  // the async search thread
+    static int32_t M_GetFuzzyScore(const char* vName, size_t vNameSize, const std::string& vSearchTag,
+                                   std::vector<size_t>* vOutPositionsPtr);  // score of the tag as a subsequence of the name, INT32_MIN if not found
+    static bool M_CompareSortKeys(const std::string& vA, const std::string& vB,  //
+                                  const size_t vSizeA, const size_t vSizeB,      //
+                                  const bool vDescendingOrder);                  // compare two sort keys, the sizes of their strings for the ties
+    void m_PrepareNaturalSortKeys(const std::vector<std::shared_ptr<FileInfos> >& vFileInfosList) const;  // make the natural sort keys of the sorting field
+    template <typename T>
+    static void m_SortFileInfosList(const std::vector<std::shared_ptr<FileInfos> >& vFileInfosList, std::vector<uint32_t>& vSortedIndexes, size_t vSortedCount, bool vParallel,
+                                    T vComparator);  // sort the indexes, or merge the indexes after vSortedCount with the sorted ones before
+    template <typename T>
+    static void M_ParallelSortIndexes(std::vector<uint32_t>& vIndexes, T vComparator);  // parallel merge sort of the indexes
+    static std::pair<size_t, size_t> M_GetParallelSortChunks(size_t vCount);            // count and size of the chunks of a parallel sort
+    static void M_RadixSortIndexes(const std::vector<std::shared_ptr<FileInfos> >& vFileInfosList, std::vector<uint32_t>& vIndexes,
+                                   uint64_t (*vGetKey)(const FileInfos&), bool vDescendingOrder);  // parallel radix sort of the indexes by type then key
+    static uint64_t M_GetSizeSortKey(const FileInfos& vInfos);                                     // radix sort key of the size
+    static uint64_t M_GetDateSortKey(const FileInfos& vInfos);                                     // radix sort key of the modification time
+    static bool M_GetLocalTime(int64_t vTime, struct tm& vOutTm);                                  // thread safe localtime when possible
+    void m_SortFields(const FileDialogInternal& vFileDialogInternal, std::vector<std::shared_ptr<FileInfos> >& vFileInfosList, std::vector<uint32_t>& vSortedIndexes,
+                      std::vector<uint32_t>& vFilteredIndexes, size_t vSortedCount = 0U);  // will sort a column, then filter
+    void m_SortFileIndexes(const FileDialogInternal& vFileDialogInternal, std::vector<std::shared_ptr<FileInfos> >& vFileInfosList, std::vector<uint32_t>& vSortedIndexes,
+                           size_t vSortedCount = 0U);  // the sort stage, without filter
+    void m_ReorderFilteredFiles(const FileDialogInternal& vFileDialogInternal);  // gather the filtered files in the new sorting order
+    static bool m_CompleteFileInfosWithUserFileAttirbutes(const FileDialogConfig& vConfig, const std::shared_ptr<FileInfos>& vInfos);
 
 public:
     FileManager();
+    ~FileManager();
     bool IsComposerEmpty() const;
     size_t GetComposerSize() const;
     bool IsFileListEmpty() const;
@@ -639,7 +993,12 @@ public:
     void ClearPathLists();  // clear path list, will destroy thumbnail textures
     void ClearAll();
     void ApplyFilteringOnFileList(const FileDialogInternal& vFileDialogInternal);
-    void SortFields(const FileDialogInternal& vFileDialogInternal);        // will sort a column
+    void ApplySearchOnFileList(const FileDialogInternal& vFileDialogInternal);  // like ApplyFilteringOnFileList, but reuse the previous search results
+    void SortFields(const FileDialogInternal& vFileDialogInternal);        // will sort a column, at the next ManageListingStages
+    void ApplySelectedFilter(const FileDialogInternal& vFileDialogInternal);  // show the files of the new selected filter at the next ManageListingStages, without scan
+    const std::vector<size_t>& GetFilesCountByFilter(const FileDialogInternal& vFileDialogInternal);  // count of listed files covered by each of the 63 first parsed filters
+                                                                                                     // (the 64th count the next ones)
+    void ManageListingStages(const FileDialogInternal& vFileDialogInternal);  // do again the dirty stages of the file list, to call each frame
     void OpenCurrentPath(const FileDialogInternal& vFileDialogInternal);   // set the path of the dialog, will launch the scandir for populate the file listview
     bool GetDevices();                                                     // list devices
     bool CreateDir(const std::string& vPath);                              // create a directory on the file system
@@ -655,6 +1014,19 @@ public:
     void SetCurrentDir(const std::string& vPath);                                                                            // define current directory for scan
     void ScanDir(const FileDialogInternal& vFileDialogInternal,
                  const std::string& vPath);  // scan the directory for retrieve the file list
+    void ManageAsyncScan(const FileDialogInternal& vFileDialogInternal);  // publish the files found by the async scan thread, to call each frame
+    bool IsScanningDirectory() const;                                     // an async scan is running
+    void ManageAsyncSearch();                                             // publish the files found by the async search thread, to call each frame
+    bool IsSearchRunning() const;                                         // an async search is running
+    size_t GetScanCountEntries() const;                                   // count of entries processed by the running async scan
+    void RequestFilteredFilesMetadata(size_t vStart, size_t vEnd);        // lazy metadata : request the metadata of the filtered files [vStart, vEnd) + prefetch
+    void ManageLazyMetadata();                                            // lazy metadata : apply the metadata loaded by the loader thread, to call each frame
+    void FormatFileInfosMetadata(const std::shared_ptr<FileInfos>& vInfos);  // format the size and the date of a displayed file, if not already done
+    bool GetFuzzyMatchPositions(const FileDialogInternal& vFileDialogInternal, const std::shared_ptr<FileInfos>& vInfos,
+                                std::vector<size_t>& vOutPositions) const;  // positions in fileNameExt of the chars found by the fuzzy search, false if no fuzzy search
+    void ClearListingCache();                                             // clear the directory listings cache
+    const ListingCacheStats& GetListingCacheStats() const;                // hits, misses and size of the directory listings cache
+    void ManageDirectoryWatch(const FileDialogInternal& vFileDialogInternal);  // apply the changes of the watched directory, to call each frame
     std::string GetResultingPath();
     std::string GetResultingFileName(FileDialogInternal& vFileDialogInternal, IGFD_ResultMode vFlag);
     std::string GetResultingFilePathName(FileDialogInternal& vFileDialogInternal, IGFD_ResultMode vFlag);
@@ -685,6 +1057,9 @@ struct IGFD_API FileDialogConfig {
     PaneFun sidePane;                                        // side pane callback
     float sidePaneWidth = 250.0f;                            // side pane width
     UserFileAttributesFun userFileAttributes;                // user file Attibutes callback
+    int32_t countScanThreads = 1;                            // count of threads for complete the scanned files, 0 for the hardware concurrency
+    int32_t countCachedListings = 0;                         // count of directory listings kept in memory for reopen them without scan, 0 for no cache
+    int32_t parallelSortThreshold = 0;                       // count of files from who the sort is done by many threads (radix sort for the sizes), 0 for never
 };
 
 class IGFD_API FileDialogInternal {
@@ -727,6 +1102,7 @@ public:
         const FileDialogConfig& vConfig);  // FileDialogConfig
     const FileDialogConfig& getDialogConfig() const;
     FileDialogConfig& getDialogConfigRef();
+    bool IsSearchRunning() const;  // an async search is running (ImGuiFileDialogFlags_AsyncSearch), the file list show the previous or the partial results
 };
 
 class IGFD_API ThumbnailFeature {
@@ -890,6 +1266,7 @@ protected:
     FileDialogInternal m_FileDialogInternal;
     ImGuiListClipper m_FileListClipper;
     ImGuiListClipper m_PathListClipper;
+    std::vector<size_t> m_FuzzyMatchPositions;  // reused for the highlight of the chars found by the fuzzy search
     float prOkCancelButtonWidth = 0.0f;
     ImGuiWindowFlags m_CurrentDisplayedFlags;
 
@@ -945,6 +1322,14 @@ public:
     std::string GetCurrentFilter();                                                                          // will return current filter
     UserDatas GetUserDatas() const;                                                                          // will return user datas send with Open Dialog
 
+    // directory listings cache (see FileDialogConfig::countCachedListings)
+    const FileManager::ListingCacheStats& GetListingCacheStats() const;  // hits, misses and size of the cache
+    void ClearListingCache();                                            // clear the cache, to do if the file styles or userFileAttributes changed
+
+    // flags of the opened dialog
+    ImGuiFileDialogFlags GetFlags() const;       // the flags given by FileDialogConfig, or by SetFlags
+    void SetFlags(ImGuiFileDialogFlags vFlags);  // by ex for show the hidden files, without scan the directory again
+
     // file style by extentions
     void SetFileStyle(                                        // SetExtention datas for have custom display of particular file type
         const IGFD_FileStyleFlags& vFlags,                    // file style
@@ -957,7 +1342,11 @@ public:
         const ImVec4& vColor,                                 // wanted color for the display of the file with extention filter
         const std::string& vIcon = "",                        // wanted text or icon of the file with extention filter
         ImFont* vFont            = nullptr);                             // wanted font
-    void SetFileStyle(FileStyle::FileStyleFunctor vFunctor);  // set file style via lambda function
+    void SetFileStyle(FileStyle::FileStyleFunctor vFunctor,   // set file style via lambda function
+                      bool vIsThreadSafe = false);            // if true, can be called by many threads at same time
+    void SetFileStyleBatch(                                   // set the style of many files via lambda function
+        FileStyle::FileStyleBatchFunctor vFunctor,            // called with the files of a scan, by batches
+        bool vIsThreadSafe = false);                          // if true, can be called by many threads at same time
     bool GetFileStyle(                                        // GetExtention datas. return true is extention exist
         const IGFD_FileStyleFlags& vFlags,                    // file style
         const std::string& vCriteria,                         // extention filter (same as used in SetExtentionInfos)
@@ -1008,6 +1397,8 @@ protected:
     void m_BeginFileColorIconStyle(std::shared_ptr<FileInfos> vFileInfos, bool& vOutShowColor, std::string& vOutStr,
                                    ImFont** vOutFont);                    // begin style apply of filter with color an icon if any
     void m_EndFileColorIconStyle(const bool& vShowColor, ImFont* vFont);  // end style apply of filter
+    void m_DrawFuzzyMatchPositions(const ImVec2& vTextPos, const std::string& vText, size_t vNameOffset,
+                                   const std::vector<size_t>& vPositions);  // highlight the chars of the name found by the fuzzy search
 
     void m_DisplayFileInfosTooltip(const int32_t& vRowIdx, const int32_t& vColumnIdx, std::shared_ptr<FileInfos> vFileInfos);
 };
@@ -1043,6 +1434,9 @@ struct IGFD_FileDialog_Config {
     IGFD_PaneFun sidePane;       // side pane callback
     float sidePaneWidth;         // side pane width};
     ImGuiFileDialogFlags flags;  // ImGuiFileDialogFlags
+    int32_t countScanThreads;    // count of threads for complete the scanned files, 0 for the hardware concurrency
+    int32_t countCachedListings; // count of directory listings kept in memory for reopen them without scan, 0 for no cache
+    int32_t parallelSortThreshold; // count of files from who the sort is done by many threads (radix sort for the sizes), 0 for never
 };
 IGFD_C_API struct IGFD_FileDialog_Config IGFD_FileDialog_Config_Get();  // return an initialized IGFD_FileDialog_Config
 
@@ -11,6 +11,17 @@
 // #define USE_CUSTOM_FILESYSTEM
 // this options need c++17
 // #define USE_STD_FILESYSTEM
+// linux only, the dirent interface read the directories with the getdents64 syscall
+// in a big reused buffer (size in bytes of this buffer with GETDENTS_BUFFER_SIZE)
+// #define USE_GETDENTS_FILESYSTEM
+// #define GETDENTS_BUFFER_SIZE (1024U * 1024U)
+// linux only (kernel 5.6+), the dirent interfaces stat the entries of a directory with batched statx requests
+// submitted to io_uring (count of requests per batch with IO_URING_STATX_BATCH_SIZE)
+// if io_uring is not available at runtime, the blocking stat is used
+// #define USE_IO_URING_STATX
+// #define IO_URING_STATX_BATCH_SIZE 256U
+// count of io_uring_enter failures retried in a batch, before to fall back to the blocking stat
+// #define IO_URING_STATX_MAX_RETRIES 16U
 
 /////////////////////////////////
 //// MISC ///////////////////////
@@ -24,6 +35,54 @@
 // #define MAX_FILE_DIALOG_NAME_BUFFER 1024
 // #define MAX_PATH_BUFFER_SIZE 1024
 
+// count of files the async directory scan (flag ImGuiFileDialogFlags_AsyncDirectoryScan)
+// accumulate before publishing them to the file list
+// #define ASYNC_SCAN_BATCH_SIZE 1024U
+
+// min count of files completed by a thread when FileDialogConfig::countScanThreads is not 1
+// #define PARALLEL_SCAN_MIN_CHUNK_SIZE 1024U
+
+// max count of states of the dfa of a regex filter, the regex filters needing more states are searched with std::regex
+// #define FILTER_REGEX_DFA_MAX_STATES 512U
+
+// max count of filters strings kept parsed and compiled for the next dialogs
+// #define PARSED_FILTERS_CACHE_MAX_COUNT 32U
+
+// max count of previous search results kept, for filter only the previous result when the search tag is refined,
+// and restore it without filtering on backspace
+// #define SEARCH_STATES_MAX_COUNT 16U
+
+// min count of files scored by a thread with the flag ImGuiFileDialogFlags_FuzzySearch
+// #define FUZZY_SEARCH_MIN_CHUNK_SIZE 8192U
+
+// with the flag ImGuiFileDialogFlags_AsyncSearch, min count of files to search for run the search in a thread,
+// and count of files searched between two publications of the found files
+// #define ASYNC_SEARCH_MIN_FILES_COUNT 16384U
+// #define ASYNC_SEARCH_BATCH_SIZE 16384U
+
+// the search of the names use sse2, and avx2 if the cpu have it, on x86_64
+// uncomment for use only the scalar search
+// #define DISABLE_SIMD_SEARCH
+
+// min count of files sorted by a thread when the count of files reach FileDialogConfig::parallelSortThreshold
+// #define PARALLEL_SORT_MIN_CHUNK_SIZE 16384U
+
+// max count of local times kept (one per 15 minutes bucket) for format the dates of the files at their first display
+// #define LOCAL_TIME_BUCKETS_MAX_COUNT 4096U
+
+// count of files before and after the displayed files, for who the size and the date are also loaded
+// with the flag ImGuiFileDialogFlags_LazyMetadata
+// #define LAZY_METADATA_PREFETCH_COUNT 64U
+
+// max estimated memory size in bytes of the directory listings cache (FileDialogConfig::countCachedListings)
+// #define LISTING_CACHE_MAX_BYTES (64U * 1024U * 1024U)
+
+// size in bytes of the blocks where the FileInfos of a listing are allocated
+// #define FILE_INFOS_STORE_BLOCK_SIZE (64U * 1024U)
+
+// size in bytes of the buffer used for read the inotify events of the watched directory (flag ImGuiFileDialogFlags_WatchDirectory)
+// #define DIRECTORY_WATCH_BUFFER_SIZE (64U * 1024U)
+
 /////////////////////////////////
 //// QUICK PATH /////////////////
 /////////////////////////////////
@@ -95,6 +154,8 @@
 // #define FILTER_COMBO_AUTO_SIZE 0
 // filter combobox width
 // #define FILTER_COMBO_MIN_WIDTH 120.0f
+// show the count of files of each filter in the filter combobox
+// #define FILTER_COMBO_SHOW_FILES_COUNT 0
 // button widget use for compose path
 // #define IMGUI_PATH_BUTTON ImGui::Button
 // standard button
@@ -115,6 +176,8 @@
 // #define fileEntryString "[FILE] "
 // #define fileNameString "File Name : "
 // #define dirNameString "Directory Path :"
+// #define scanningDirectoryString "Scanning %zu entries..."
+// #define searchingString "Searching..."
 // #define buttonResetSearchString "Reset search"
 // #define buttonDriveString "Devices"
 // #define buttonEditPathString "Edit path\nYou can also right click on path buttons"